@@ -0,0 +1,314 @@
+// Helpers shared by the native benchmarks in this directory.
+//
+// The benchmarks link the generated parsers (`src/parser.c`, `block/src/parser.c` and
+// `inline/src/parser.c`, run `tree-sitter generate` first), the external scanners and the
+// tree-sitter runtime library. See the comment at the
+// top of each benchmark for how to build it.
+
+#ifndef TREE_SITTER_MARKDOWN_BENCH_H_
+#define TREE_SITTER_MARKDOWN_BENCH_H_
+
+#include <tree_sitter/api.h>
+#include <sys/resource.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+extern "C" const TSLanguage *tree_sitter_markdown();
+extern "C" const TSLanguage *tree_sitter_markdown_block();
+extern "C" const TSLanguage *tree_sitter_markdown_inline();
+
+namespace bench {
+
+// Seconds since some fixed point in time.
+inline double now() {
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Peak resident set size of this process in kilobytes.
+inline long peak_rss_kb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+inline string read_file(const string &path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        fprintf(stderr, "could not open %s\n", path.c_str());
+        exit(1);
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+// Extract the inputs of all examples from a tree-sitter corpus file like `corpus/spec.txt`.
+//
+// Every example consists of a header delimited by lines of `=`, the input and the expected output,
+// which are separated by a line of `-`.
+inline vector<string> corpus_examples(const string &path) {
+    std::istringstream text(read_file(path));
+    vector<string> examples;
+    enum { EXPECTED, HEADER, INPUT } part = EXPECTED;
+    string line;
+    string input;
+    while (std::getline(text, line)) {
+        if (part != INPUT && line.compare(0, 3, "===") == 0) {
+            part = part == HEADER ? INPUT : HEADER;
+            input.clear();
+        } else if (part == INPUT && line.compare(0, 3, "---") == 0) {
+            // Like `tree-sitter test` drop the newline right before the divider
+            if (!input.empty()) input.pop_back();
+            examples.push_back(input);
+            part = EXPECTED;
+        } else if (part == INPUT) {
+            input += line + "\n";
+        }
+    }
+    return examples;
+}
+
+// Count all nodes of a tree, named and anonymous.
+inline size_t count_nodes(const TSTree *tree) {
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+    size_t count = 1;
+    for (;;) {
+        if (ts_tree_cursor_goto_first_child(&cursor)) {
+            count++;
+            continue;
+        }
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                ts_tree_cursor_delete(&cursor);
+                return count;
+            }
+        }
+        count++;
+    }
+}
+
+// TWO PHASE PARSING
+//
+// The block grammar exposes the contents of paragraphs and headings as `inline` nodes, which are
+// parsed with the inline grammar on demand.
+
+// The ranges to parse with the inline grammar for an `inline` node of the block grammar. These
+// are the range of the node without the block quote markers of continuation lines.
+inline vector<TSRange> inline_ranges(TSNode node) {
+    vector<TSRange> ranges;
+    TSRange range;
+    range.start_byte = ts_node_start_byte(node);
+    range.start_point = ts_node_start_point(node);
+    uint32_t count = ts_node_named_child_count(node);
+    for (uint32_t i = 0; i < count; i++) {
+        TSNode child = ts_node_named_child(node, i);
+        if (strcmp(ts_node_type(child), "block_quote_marker") != 0) continue;
+        range.end_byte = ts_node_start_byte(child);
+        range.end_point = ts_node_start_point(child);
+        if (range.end_byte > range.start_byte) ranges.push_back(range);
+        range.start_byte = ts_node_end_byte(child);
+        range.start_point = ts_node_end_point(child);
+    }
+    range.end_byte = ts_node_end_byte(node);
+    range.end_point = ts_node_end_point(node);
+    if (range.end_byte > range.start_byte) ranges.push_back(range);
+    return ranges;
+}
+
+// Collect all `inline` nodes of a block tree that intersect the byte range [start, end).
+inline void collect_inline_nodes(TSNode node, uint32_t start, uint32_t end, vector<TSNode> &result) {
+    if (ts_node_end_byte(node) <= start || ts_node_start_byte(node) >= end) return;
+    if (strcmp(ts_node_type(node), "inline") == 0) {
+        result.push_back(node);
+        return;
+    }
+    uint32_t count = ts_node_named_child_count(node);
+    for (uint32_t i = 0; i < count; i++) {
+        collect_inline_nodes(ts_node_named_child(node, i), start, end, result);
+    }
+}
+
+// Parse the contents of an `inline` node with a parser for the inline grammar.
+inline TSTree *parse_inline(TSParser *parser, const string &document, TSNode node) {
+    vector<TSRange> ranges = inline_ranges(node);
+    if (ranges.empty()) return NULL;
+    ts_parser_set_included_ranges(parser, ranges.data(), ranges.size());
+    return ts_parser_parse_string(parser, NULL, document.data(), document.size());
+}
+
+// The row and column of a byte offset.
+inline TSPoint point_at(const string &text, size_t byte) {
+    TSPoint point = {0, 0};
+    for (size_t i = 0; i < byte; i++) {
+        if (text[i] == '\n') {
+            point.row++;
+            point.column = 0;
+        } else {
+            point.column++;
+        }
+    }
+    return point;
+}
+
+// A single text edit: replace `removed` bytes at `start` with `inserted`.
+struct Edit {
+    size_t start;
+    size_t removed;
+    string inserted;
+};
+
+// Apply an edit to `text` and return the corresponding edit for `ts_tree_edit`.
+inline TSInputEdit apply_edit(string &text, const Edit &edit) {
+    TSInputEdit input_edit;
+    input_edit.start_byte = edit.start;
+    input_edit.old_end_byte = edit.start + edit.removed;
+    input_edit.new_end_byte = edit.start + edit.inserted.size();
+    input_edit.start_point = point_at(text, input_edit.start_byte);
+    input_edit.old_end_point = point_at(text, input_edit.old_end_byte);
+    text.replace(edit.start, edit.removed, edit.inserted);
+    input_edit.new_end_point = point_at(text, input_edit.new_end_byte);
+    return input_edit;
+}
+
+// Statistics gathered from the parser's debug log. `lexed_bytes` counts the bytes of all tokens
+// the lexer produced, `reused_nodes` the subtrees taken over from the old tree.
+struct LexStats {
+    size_t lexed_bytes;
+    size_t lexed_tokens;
+    size_t reused_nodes;
+};
+
+inline void log_lex_stats(void *payload, TSLogType type, const char *message) {
+    LexStats *stats = static_cast<LexStats *>(payload);
+    if (strncmp(message, "lexed_lookahead", 15) == 0) {
+        const char *size = strstr(message, "size:");
+        if (size) stats->lexed_bytes += strtoul(size + 5, NULL, 10);
+        stats->lexed_tokens++;
+    } else if (strncmp(message, "reuse_node", 10) == 0) {
+        stats->reused_nodes++;
+    }
+}
+
+// Install a logger that accumulates into `stats`. Logging slows down parsing considerably, so do
+// not combine this with timing measurements.
+inline void set_lex_stats_logger(TSParser *parser, LexStats *stats) {
+    TSLogger logger = {stats, log_lex_stats};
+    ts_parser_set_logger(parser, logger);
+}
+
+inline void clear_logger(TSParser *parser) {
+    TSLogger logger = {NULL, NULL};
+    ts_parser_set_logger(parser, logger);
+}
+
+// The value at `percentile` (between 0 and 1) of a list of samples.
+inline double percentile(vector<double> samples, double percentile) {
+    if (samples.empty()) return 0;
+    std::sort(samples.begin(), samples.end());
+    size_t index = (size_t)(percentile * (samples.size() - 1) + 0.5);
+    return samples[index];
+}
+
+// SYNTHETIC DOCUMENTS
+//
+// Every generator repeats a characteristic section until the document is at least `size` bytes.
+
+// A README-like document mixing all common constructs.
+inline string synthetic_readme(size_t size) {
+    string section =
+        "# Project title\n"
+        "\n"
+        "Some *introductory* text with a [link](https://example.com \"title\") and `inline code`.\n"
+        "It continues on a second line with **strong emphasis** and an image ![alt](img.png).\n"
+        "\n"
+        "## Installation\n"
+        "\n"
+        "1. Download the package\n"
+        "2. Run the installer:\n"
+        "\n"
+        "   ```sh\n"
+        "   make && make install\n"
+        "   ```\n"
+        "\n"
+        "> **Note**\n"
+        "> Block quotes can contain _emphasis_ and lazy\n"
+        "continuation lines.\n"
+        "\n"
+        "- item with &amp; entity\n"
+        "- item with <span>html</span>\n"
+        "    - nested item\n"
+        "\n"
+        "[ref]: https://example.com/ref\n"
+        "\n";
+    string result;
+    while (result.size() < size) result += section;
+    return result;
+}
+
+// Deeply nested lists and block quotes.
+inline string synthetic_deep_lists(size_t size) {
+    string section;
+    string indentation;
+    for (int depth = 0; depth < 16; depth++) {
+        section += indentation + "- level " + std::to_string(depth) + "\n";
+        indentation += "  ";
+    }
+    for (int depth = 0; depth < 8; depth++) {
+        section += string(depth + 1, '>') + " quoted " + std::to_string(depth) + "\n";
+    }
+    section += "\n";
+    string result;
+    while (result.size() < size) result += section;
+    return result;
+}
+
+// Mostly fenced and indented code blocks.
+inline string synthetic_code_heavy(size_t size) {
+    string section =
+        "Example:\n"
+        "\n"
+        "```cpp\n"
+        "int main(int argc, char **argv) {\n"
+        "    for (int i = 0; i < argc; i++) printf(\"%s\\n\", argv[i]);\n"
+        "    return 0; // *not* emphasis, [not] a link\n"
+        "}\n"
+        "```\n"
+        "\n"
+        "    $ ./main --flag=value\n"
+        "    <output>\n"
+        "\n";
+    string result;
+    while (result.size() < size) result += section;
+    return result;
+}
+
+// Long paragraphs dense with emphasis delimiters.
+inline string synthetic_emphasis_heavy(size_t size) {
+    string section =
+        "This *is* **very** _emphasized_ __prose__ with *nested **strong** text* and\n"
+        "some *unmatched delimiters _here and ***there*** and a_b*c snake_case_word.\n"
+        "***Triple*** and *__mixed__* runs **end *here***.\n"
+        "\n";
+    string result;
+    while (result.size() < size) result += section;
+    return result;
+}
+
+}  // namespace bench
+
+#endif  // TREE_SITTER_MARKDOWN_BENCH_H_
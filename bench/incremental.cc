@@ -0,0 +1,173 @@
+// Incremental parsing benchmark.
+//
+// Replays editing sessions (typing in a paragraph, opening a code fence, indenting a list item, ...)
+// against a large document. Every keystroke is applied with `ts_tree_edit` and followed by a reparse
+// that reuses the old tree. Reports the p50/p99 reparse latency, the number of bytes the lexer had
+// to process per edit, the number of subtrees reused from the old tree per edit and the reuse
+// ratio, the share of the document that did not have to be lexed again.
+//
+// Build (after `tree-sitter generate`, against an installed tree-sitter runtime):
+//
+//     cc -O2 -std=c99 -Isrc -c src/parser.c -o parser.o
+//     c++ -O2 -std=c++11 -Isrc bench/incremental.cc src/scanner.cc parser.o -ltree-sitter -o incremental
+//
+// Usage:
+//
+//     ./incremental [--size <KB>] [file]
+//
+// If a file is given it is used as the document instead of a synthetic README. Edits are placed
+// relative to the first occurrence of their anchor text after the middle of the document.
+
+#include "bench.h"
+
+struct Session {
+    string name;
+    vector<bench::Edit> edits;
+};
+
+// Type `text` one character at a time at `position`.
+static void type(vector<bench::Edit> &edits, size_t position, const string &text) {
+    for (size_t i = 0; i < text.size(); i++) {
+        edits.push_back({position + i, 0, string(1, text[i])});
+    }
+}
+
+// Delete `count` characters before `position` one at a time, like pressing backspace.
+static void backspace(vector<bench::Edit> &edits, size_t position, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        edits.push_back({position - i - 1, 1, ""});
+    }
+}
+
+// Position of `anchor` in the second half of the document.
+static size_t find_anchor(const string &document, const string &anchor) {
+    size_t position = document.find(anchor, document.size() / 2);
+    if (position == string::npos) position = document.find(anchor);
+    if (position == string::npos) {
+        fprintf(stderr, "document does not contain \"%s\"\n", anchor.c_str());
+        exit(1);
+    }
+    return position;
+}
+
+static vector<Session> sessions(const string &document) {
+    vector<Session> result;
+
+    // Typing a sentence inside a paragraph
+    {
+        Session session = {"type-in-paragraph", {}};
+        size_t position = find_anchor(document, " text with a [link]") + 5;
+        type(session.edits, position, " and some *freshly typed* words");
+        result.push_back(session);
+    }
+
+    // Opening a fenced code block above existing content and removing it again. While the fence
+    // is open the rest of the document becomes code.
+    {
+        Session session = {"open-fence", {}};
+        size_t position = find_anchor(document, "\n## Installation") + 1;
+        type(session.edits, position, "```js\n");
+        backspace(session.edits, position + 6, 6);
+        result.push_back(session);
+    }
+
+    // Indenting a list item so it becomes part of the previous item and dedenting it again.
+    {
+        Session session = {"indent-list-item", {}};
+        size_t position = find_anchor(document, "\n- item with <span>") + 1;
+        type(session.edits, position, "    ");
+        backspace(session.edits, position + 4, 4);
+        result.push_back(session);
+    }
+
+    // Typing a code span into a list item. Inline state like the length of the code span must not
+    // keep the rest of the list from being reused.
+    {
+        Session session = {"type-in-list-item", {}};
+        size_t position = find_anchor(document, "- item with &amp; entity") + 24;
+        type(session.edits, position, " and `code`");
+        result.push_back(session);
+    }
+
+    // Typing at the end of a lazy continuation line of a block quote.
+    {
+        Session session = {"type-in-block-quote", {}};
+        size_t position = find_anchor(document, "continuation lines.") + 19;
+        type(session.edits, position, " More text\n> and *another* line");
+        result.push_back(session);
+    }
+
+    return result;
+}
+
+// Replay a session and record the latency of every reparse. If `stats` is not NULL, the parser
+// logs lexer statistics into it instead, which makes the timings meaningless.
+static vector<double> replay(
+    TSParser *parser,
+    const string &document,
+    const Session &session,
+    bench::LexStats *stats
+) {
+    string text = document;
+    TSTree *tree = ts_parser_parse_string(parser, NULL, text.data(), text.size());
+    if (stats) bench::set_lex_stats_logger(parser, stats);
+    vector<double> latencies;
+    for (const bench::Edit &edit : session.edits) {
+        TSInputEdit input_edit = bench::apply_edit(text, edit);
+        ts_tree_edit(tree, &input_edit);
+        double start = bench::now();
+        TSTree *new_tree = ts_parser_parse_string(parser, tree, text.data(), text.size());
+        latencies.push_back(bench::now() - start);
+        ts_tree_delete(tree);
+        tree = new_tree;
+    }
+    if (stats) bench::clear_logger(parser);
+    ts_tree_delete(tree);
+    return latencies;
+}
+
+int main(int argc, char **argv) {
+    size_t size = 1024;
+    string document;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            size = strtoul(argv[++i], NULL, 10);
+        } else {
+            document = bench::read_file(argv[i]);
+        }
+    }
+    if (document.empty()) document = bench::synthetic_readme(size * 1024);
+
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, tree_sitter_markdown());
+
+    double start = bench::now();
+    ts_tree_delete(ts_parser_parse_string(parser, NULL, document.data(), document.size()));
+    printf("full parse of %zu bytes: %.2f ms\n\n", document.size(), (bench::now() - start) * 1e3);
+
+    printf(
+        "%-20s %6s %10s %10s %10s %14s %14s %12s\n",
+        "session", "edits", "p50 (us)", "p99 (us)", "max (us)", "lexed B/edit", "reused/edit",
+        "reuse ratio"
+    );
+    for (const Session &session : sessions(document)) {
+        vector<double> latencies = replay(parser, document, session, NULL);
+        bench::LexStats stats = {0, 0, 0};
+        replay(parser, document, session, &stats);
+        double edits = session.edits.size();
+        printf(
+            "%-20s %6zu %10.1f %10.1f %10.1f %14.1f %14.1f %11.2f%%\n",
+            session.name.c_str(),
+            session.edits.size(),
+            bench::percentile(latencies, 0.5) * 1e6,
+            bench::percentile(latencies, 0.99) * 1e6,
+            bench::percentile(latencies, 1) * 1e6,
+            stats.lexed_bytes / edits,
+            stats.reused_nodes / edits,
+            100.0 * (1.0 - stats.lexed_bytes / edits / document.size())
+        );
+    }
+
+    ts_parser_delete(parser);
+    return 0;
+}
@@ -0,0 +1,114 @@
+// External scanner state benchmark.
+//
+// The external scanner serializes its state after every external token and tree-sitter stores it
+// with the token: inline if it has at most 24 bytes, otherwise in a separate heap allocation per
+// token. This parses the examples of `corpus/spec.txt`, a set of large synthetic documents and any
+// files given on the command line with the full and the block grammar and reports how large these
+// states are: the number of external tokens, the average and maximum state size, the share of
+// states that do not fit inline and the heap memory they need.
+//
+// Build (after running `tree-sitter generate` in the root and `block` directories, against an
+// installed tree-sitter runtime):
+//
+//     cc -O2 -std=c99 -Isrc -c src/parser.c -o parser.o
+//     cc -O2 -std=c99 -Iblock/src -c block/src/parser.c -o block_parser.o
+//     SOURCES="bench/memory.cc src/scanner.cc block/src/scanner.cc"
+//     c++ -O2 -std=c++11 -Isrc $SOURCES parser.o block_parser.o -ltree-sitter -o memory
+//
+// Usage:
+//
+//     ./memory [--size <MB>] [files...]
+
+#include "bench.h"
+#include <tree_sitter/parser.h>
+
+// Largest external scanner state tree-sitter stores inline in a token
+const unsigned INLINE_STATE_SIZE = 24;
+
+struct StateStats {
+    size_t tokens;
+    size_t bytes;
+    size_t heap_tokens;
+    size_t heap_bytes;
+    unsigned max_size;
+};
+
+static StateStats stats;
+static unsigned (*scanner_serialize)(void *, char *);
+
+// Wraps the serialize function of the external scanner to record the size of every state
+static unsigned serialize(void *payload, char *buffer) {
+    unsigned length = scanner_serialize(payload, buffer);
+    stats.tokens++;
+    stats.bytes += length;
+    if (length > INLINE_STATE_SIZE) {
+        stats.heap_tokens++;
+        stats.heap_bytes += length;
+    }
+    if (length > stats.max_size) stats.max_size = length;
+    return length;
+}
+
+// A copy of `language` that records the sizes of its scanner states in `stats`. Set
+// `scanner_serialize` to the serialize function of `language` before using it.
+static TSLanguage instrument(const TSLanguage *language) {
+    TSLanguage result = *language;
+    result.external_scanner.serialize = serialize;
+    return result;
+}
+
+int main(int argc, char **argv) {
+    size_t size = 10;
+    vector<string> files;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            size = strtoul(argv[++i], NULL, 10);
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+    size *= 1024 * 1024;
+
+    vector<std::pair<string, vector<string>>> workloads;
+    workloads.push_back({"spec", bench::corpus_examples("corpus/spec.txt")});
+    workloads.push_back({"readme", {bench::synthetic_readme(size)}});
+    workloads.push_back({"deep-lists", {bench::synthetic_deep_lists(size)}});
+    workloads.push_back({"code-heavy", {bench::synthetic_code_heavy(size)}});
+    workloads.push_back({"emphasis-heavy", {bench::synthetic_emphasis_heavy(size)}});
+    for (const string &file : files) {
+        workloads.push_back({file, {bench::read_file(file)}});
+    }
+
+    const char *names[] = {"full", "block"};
+    const TSLanguage *languages[] = {tree_sitter_markdown(), tree_sitter_markdown_block()};
+
+    printf(
+        "%-20s %-6s %12s %10s %6s %9s %12s %14s\n",
+        "workload", "mode", "tokens", "avg bytes", "max", "on heap", "heap KB", "peak RSS (KB)"
+    );
+    for (const auto &workload : workloads) {
+        for (size_t i = 0; i < 2; i++) {
+            scanner_serialize = languages[i]->external_scanner.serialize;
+            TSLanguage language = instrument(languages[i]);
+            TSParser *parser = ts_parser_new();
+            ts_parser_set_language(parser, &language);
+            stats = StateStats();
+            for (const string &document : workload.second) {
+                ts_tree_delete(ts_parser_parse_string(parser, NULL, document.data(), document.size()));
+            }
+            ts_parser_delete(parser);
+            printf(
+                "%-20s %-6s %12zu %10.2f %6u %8.2f%% %12.1f %14ld\n",
+                workload.first.c_str(),
+                names[i],
+                stats.tokens,
+                stats.tokens ? (double)stats.bytes / stats.tokens : 0.0,
+                stats.max_size,
+                stats.tokens ? 100.0 * stats.heap_tokens / stats.tokens : 0.0,
+                stats.heap_bytes / 1024.0,
+                bench::peak_rss_kb()
+            );
+        }
+    }
+    return 0;
+}
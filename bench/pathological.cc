@@ -0,0 +1,291 @@
+// Pathological input benchmark.
+//
+// Generates inputs known to make markdown parsers slow, like the pathological tests of the
+// CommonMark reference implementations: deeply nested block quotes and lists, long runs of
+// brackets, emphasis delimiters that never close, backtick strings of many different lengths,
+// unclosed html and so on. Every case is parsed with the full grammar at two sizes, `size` and
+// `SCALE * size` bytes, each in a child process of its own, and has to stay within budgets that
+// grow linearly with the input size:
+//
+// * time: the parse may take at most `time_budget` times as long per byte as a synthetic README
+//   of the same size, which is parsed first to calibrate the budgets to the machine
+// * scaling: parsing the larger input may take at most `SCALING_TOLERANCE` times longer than
+//   linear growth predicts, which catches superlinear behaviour independent of the machine
+// * memory: the peak resident set size of the child may grow by at most `memory_budget` bytes per
+//   input byte
+//
+// A parse that exceeds its time budget by far is cancelled with `ts_parser_set_timeout_micros`.
+//
+// The process exits with status 1 if any case is over budget. With `--report-only` cases over budget
+// are only reported. The budgets of the cases, `SCALING_TOLERANCE` and `TIMEOUT_FACTOR` are
+// placeholders that have not been measured against a build of the generated parser yet. Tune them
+// from a measured run, `--report-only` prints the measured values of every case.
+//
+// Build (after `tree-sitter generate`, against an installed tree-sitter runtime):
+//
+//     cc -O2 -std=c99 -Isrc -c src/parser.c -o parser.o
+//     SOURCES="bench/pathological.cc src/scanner.cc"
+//     c++ -O2 -std=c++11 -Isrc $SOURCES parser.o -ltree-sitter -o pathological
+//
+// Usage:
+//
+//     ./pathological [--size <KB>] [--only <case>] [--report-only]
+
+#include "bench.h"
+#include <functional>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Factor between the two input sizes of every case
+const size_t SCALE = 4;
+// How much slower than linear the larger input may be parsed. Placeholder, see above.
+const double SCALING_TOLERANCE = 2;
+// Cancel parses that take this many times longer than their time budget. Placeholder, see above.
+const double TIMEOUT_FACTOR = 4;
+
+struct Case {
+    string name;
+    // Generates an input of at least the given number of bytes
+    std::function<string(size_t)> generate;
+    // Maximum parse time per byte relative to the synthetic README. Placeholder, see above.
+    double time_budget;
+    // Maximum growth of the peak resident set size in bytes per input byte. Placeholder, see above.
+    double memory_budget;
+};
+
+struct Measurement {
+    size_t bytes;
+    size_t nodes;
+    double seconds;
+    long rss_kb;
+    bool timed_out;
+};
+
+// `text` repeated until the result is at least `size` bytes long.
+static string repeat(const string &text, size_t size) {
+    string result;
+    result.reserve(size + text.size());
+    while (result.size() < size) result += text;
+    return result;
+}
+
+// `open` repeated to fill half of `size`, then `middle`, then as many `close` as `open`.
+static string nest(const string &open, const string &middle, const string &close, size_t size) {
+    size_t count = size / 2 / open.size() + 1;
+    string result;
+    for (size_t i = 0; i < count; i++) result += open;
+    result += middle;
+    for (size_t i = 0; i < count; i++) result += close;
+    return result;
+}
+
+static vector<Case> cases() {
+    vector<Case> result;
+    // Block structure
+    result.push_back({"nested-block-quotes", [](size_t size) {
+        return repeat(">", size) + " a\n";
+    }, 4, 512});
+    result.push_back({"nested-block-quote-lines", [](size_t size) {
+        string section;
+        for (int depth = 1; depth <= 64; depth++) section += string(depth, '>') + " a\n";
+        return repeat(section, size);
+    }, 4, 512});
+    result.push_back({"nested-list-markers", [](size_t size) {
+        return repeat("- ", size) + "a\n";
+    }, 4, 512});
+    result.push_back({"nested-list-lines", [](size_t size) {
+        string section;
+        for (int depth = 0; depth < 64; depth++) section += string(2 * depth, ' ') + "- a\n";
+        return repeat(section, size);
+    }, 4, 512});
+    result.push_back({"lazy-continuation-lines", [](size_t size) {
+        return repeat("> - a\nb\n", size);
+    }, 4, 512});
+    // Links and images
+    result.push_back({"open-brackets", [](size_t size) { return repeat("[", size); }, 4, 512});
+    result.push_back({"nested-brackets", [](size_t size) {
+        return nest("[", "a", "]", size);
+    }, 4, 512});
+    result.push_back({"nested-images", [](size_t size) {
+        return nest("![", "a", "]", size);
+    }, 8, 512});
+    result.push_back({"open-images", [](size_t size) { return repeat("![a ", size); }, 8, 512});
+    result.push_back({"unclosed-destinations", [](size_t size) {
+        return repeat("[a](", size);
+    }, 4, 512});
+    result.push_back({"open-parentheses", [](size_t size) {
+        return "[a](" + repeat("(", size);
+    }, 4, 512});
+    result.push_back({"close-brackets-with-parentheses", [](size_t size) {
+        return repeat("](", size);
+    }, 4, 512});
+    result.push_back({"images-in-link-text", [](size_t size) {
+        return repeat("[a ![b", size);
+    }, 8, 512});
+    // Emphasis
+    result.push_back({"alternating-delimiters", [](size_t size) {
+        return repeat("*a_", size);
+    }, 8, 512});
+    result.push_back({"unclosed-emphasis", [](size_t size) {
+        return repeat("*a ", size);
+    }, 8, 512});
+    result.push_back({"unclosed-emphasis-lines", [](size_t size) {
+        return repeat("*a **b\n", size);
+    }, 8, 512});
+    result.push_back({"openers-then-closers", [](size_t size) {
+        return nest("*a ", "b", " c*", size);
+    }, 8, 512});
+    result.push_back({"nested-emphasis", [](size_t size) {
+        return nest("*a **b ", "c", "** d*", size);
+    }, 8, 512});
+    // Code spans
+    result.push_back({"backtick-strings", [](size_t size) {
+        string result;
+        for (size_t length = 1; result.size() < size; length++) {
+            result += string(length % 64 + 1, '`') + "a";
+        }
+        return result;
+    }, 4, 512});
+    result.push_back({"unclosed-backtick-strings", [](size_t size) {
+        string result;
+        for (size_t length = 9; result.size() < size; length++) result += string(length, '`') + "a";
+        return result;
+    }, 4, 512});
+    // Html
+    result.push_back({"unclosed-angle-brackets", [](size_t size) {
+        return repeat("<a ", size);
+    }, 4, 512});
+    result.push_back({"unclosed-attributes", [](size_t size) {
+        return repeat("<a b='", size);
+    }, 4, 512});
+    result.push_back({"unclosed-comments", [](size_t size) {
+        return repeat("a <!-- ", size);
+    }, 4, 512});
+    result.push_back({"html-block-starts", [](size_t size) {
+        return repeat("<div>\n<!--\n", size);
+    }, 4, 512});
+    // Everything else
+    result.push_back({"entities", [](size_t size) { return repeat("&a", size); }, 4, 512});
+    result.push_back({"backslashes", [](size_t size) { return repeat("\\", size); }, 4, 512});
+    result.push_back({"hard-line-breaks", [](size_t size) {
+        return repeat("a  \n", size);
+    }, 4, 512});
+    result.push_back({"long-paragraph", [](size_t size) {
+        return repeat("a *b* [c](d) `e` <f> &amp; \\* ", size);
+    }, 4, 512});
+    result.push_back({"long-paragraph-of-links", [](size_t size) {
+        return repeat("[a](b)", size);
+    }, 4, 512});
+    result.push_back({"long-paragraph-of-emphasis", [](size_t size) {
+        return repeat("*a* ", size);
+    }, 4, 512});
+    return result;
+}
+
+// Parse `document` in a child process, so the peak resident set size is that of this parse only.
+// The parse is cancelled after `timeout` seconds unless it is 0.
+static Measurement measure(const string &document, double timeout) {
+    Measurement result = {document.size(), 0, 0, 0, false};
+    int fds[2];
+    if (pipe(fds) != 0) {
+        perror("pipe");
+        exit(1);
+    }
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        exit(1);
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        long rss_before = bench::peak_rss_kb();
+        TSParser *parser = ts_parser_new();
+        ts_parser_set_language(parser, tree_sitter_markdown());
+        ts_parser_set_timeout_micros(parser, (uint64_t)(timeout * 1e6));
+        double start = bench::now();
+        TSTree *tree = ts_parser_parse_string(parser, NULL, document.data(), document.size());
+        result.seconds = bench::now() - start;
+        result.timed_out = tree == NULL;
+        if (tree) {
+            result.nodes = bench::count_nodes(tree);
+            ts_tree_delete(tree);
+        }
+        ts_parser_delete(parser);
+        result.rss_kb = bench::peak_rss_kb() - rss_before;
+        ssize_t written = write(fds[1], &result, sizeof(result));
+        _exit(written == sizeof(result) ? 0 : 1);
+    }
+    close(fds[1]);
+    ssize_t length = read(fds[0], &result, sizeof(result));
+    close(fds[0]);
+    int status;
+    waitpid(pid, &status, 0);
+    if (length != sizeof(result) || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        fprintf(stderr, "parser process failed\n");
+        exit(1);
+    }
+    return result;
+}
+
+int main(int argc, char **argv) {
+    size_t size = 256;
+    const char *only = NULL;
+    bool report_only = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            size = strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--only") == 0 && i + 1 < argc) {
+            only = argv[++i];
+        } else if (strcmp(argv[i], "--report-only") == 0) {
+            report_only = true;
+        }
+    }
+    size *= 1024;
+
+    // Parse time per byte of an ordinary document, the unit of all time budgets
+    Measurement baseline = measure(bench::synthetic_readme(SCALE * size), 0);
+    double seconds_per_byte = baseline.seconds / baseline.bytes;
+    printf("readme: %zu bytes in %.2f ms\n\n", baseline.bytes, baseline.seconds * 1e3);
+
+    printf(
+        "%-32s %10s %10s %8s %8s %10s %10s  %s\n",
+        "case", "bytes", "ms", "x readme", "scaling", "nodes/byte", "RSS B/byte", "result"
+    );
+    bool ok = true;
+    for (const Case &c : cases()) {
+        if (only && c.name != only) continue;
+        string document = c.generate(size);
+        double budget = c.time_budget * seconds_per_byte * document.size();
+        Measurement small = measure(document, TIMEOUT_FACTOR * budget);
+        document = c.generate(SCALE * size);
+        budget = c.time_budget * seconds_per_byte * document.size();
+        Measurement large = measure(document, TIMEOUT_FACTOR * budget);
+        double slowdown = large.seconds / large.bytes / seconds_per_byte;
+        double scaling = (large.seconds / small.seconds) / ((double)large.bytes / small.bytes);
+        double memory = large.rss_kb * 1024.0 / large.bytes;
+        const char *failure = NULL;
+        if (small.timed_out || large.timed_out) {
+            failure = "timed out";
+        } else if (large.seconds > budget) {
+            failure = "over time budget";
+        } else if (scaling > SCALING_TOLERANCE) {
+            failure = "superlinear";
+        } else if (memory > c.memory_budget) {
+            failure = "over memory budget";
+        }
+        if (failure) ok = false;
+        printf(
+            "%-32s %10zu %10.2f %8.2f %8.2f %10.3f %10.1f  %s\n",
+            c.name.c_str(),
+            large.bytes,
+            large.seconds * 1e3,
+            slowdown,
+            scaling,
+            (double)large.nodes / large.bytes,
+            memory,
+            failure ? failure : "ok"
+        );
+    }
+    if (!ok && report_only) printf("\nsome cases are over their budgets\n");
+    return ok || report_only ? 0 : 1;
+}
@@ -0,0 +1,219 @@
+// Tree memory profiler.
+//
+// Parses a file and reports what its syntax tree is made of: the total number of nodes, how many
+// of them are hidden (rules and tokens starting with `_`, repetitions, ...) and how many are
+// visible, the memory the tree takes per input byte and how much external scanner state is stored
+// with the tree. A histogram breaks the nodes and their memory down by type, visible types first.
+//
+// Hidden nodes are not accessible through the public tree-sitter API, so this walks tree-sitter's
+// internal tree representation. Nodes are either leaves stored inline in their parent, which take
+// no memory of their own, or heap allocated together with the array of their children. External
+// scanner states longer than 24 bytes are stored in a separate allocation. Subtrees shared between
+// several parents are counted once.
+//
+// Build (after `tree-sitter generate` in the root and `block` directories), against the sources
+// of the tree-sitter runtime, since the internal headers have to match the library exactly:
+//
+//     FLAGS="-O2 -I$TREE_SITTER/lib/include -I$TREE_SITTER/lib/src"
+//     cc $FLAGS -std=c99 -c $TREE_SITTER/lib/src/lib.c -o lib.o
+//     cc -O2 -std=c99 -Isrc -c src/parser.c -o parser.o
+//     cc -O2 -std=c99 -Iblock/src -c block/src/parser.c -o block_parser.o
+//     SOURCES="bench/profile.cc src/scanner.cc block/src/scanner.cc"
+//     c++ $FLAGS -std=c++11 -Isrc $SOURCES parser.o block_parser.o lib.o -o profile
+//
+// Usage:
+//
+//     ./profile [--block] [--all] <file>
+//
+// With `--block` the file is parsed with the block grammar. `--all` also lists the types of
+// `node-types.json` that do not occur in the file.
+
+#include "bench.h"
+#include <map>
+#include <set>
+#include <unordered_set>
+#include "tree.h"
+
+// Size up to which tree-sitter stores an external scanner state inline in its token
+const unsigned INLINE_STATE_SIZE = 24;
+
+struct TypeStats {
+    bool visible;
+    bool named;
+    size_t nodes;
+    size_t bytes;
+};
+
+struct TreeStats {
+    size_t nodes;
+    size_t visible_nodes;
+    size_t named_nodes;
+    size_t inline_leaves;
+    size_t heap_nodes;
+    size_t bytes;
+    size_t external_tokens;
+    size_t heap_states;
+    size_t heap_state_bytes;
+    // By name and whether the type is named
+    std::map<std::pair<string, bool>, TypeStats> types;
+};
+
+// The types listed in a `node-types.json`, with whether they are named. Only looks for the
+// `"type"` and `"named"` keys, which is enough for the files tree-sitter generates.
+static std::set<std::pair<string, bool>> node_types(const string &path) {
+    string json = bench::read_file(path);
+    std::set<std::pair<string, bool>> result;
+    const string type_key = "\"type\": \"";
+    const string named_key = "\"named\": ";
+    for (size_t i = json.find(type_key); i != string::npos; i = json.find(type_key, i)) {
+        i += type_key.size();
+        string name;
+        for (; i < json.size() && json[i] != '"'; i++) {
+            if (json[i] == '\\' && i + 1 < json.size()) i++;
+            name += json[i];
+        }
+        size_t named = json.find(named_key, i);
+        if (named == string::npos) break;
+        result.insert({name, json.compare(named + named_key.size(), 4, "true") == 0});
+    }
+    return result;
+}
+
+static void profile(const TSTree *tree, TreeStats &stats) {
+    const TSLanguage *language = ts_tree_language(tree);
+    std::unordered_set<const void *> seen;
+    vector<Subtree> stack = {tree->root};
+    while (!stack.empty()) {
+        Subtree subtree = stack.back();
+        stack.pop_back();
+        size_t bytes = 0;
+        if (!subtree.data.is_inline) {
+            if (!seen.insert(subtree.ptr).second) continue;
+            uint32_t child_count = ts_subtree_child_count(subtree);
+            bytes = ts_subtree_alloc_size(child_count);
+            stats.heap_nodes++;
+            if (child_count == 0 && ts_subtree_has_external_tokens(subtree)) {
+                unsigned length = subtree.ptr->external_scanner_state.length;
+                stats.external_tokens++;
+                if (length > INLINE_STATE_SIZE) {
+                    stats.heap_states++;
+                    stats.heap_state_bytes += length;
+                    bytes += length;
+                }
+            }
+            Subtree *children = ts_subtree_children(subtree);
+            for (uint32_t i = 0; i < child_count; i++) stack.push_back(children[i]);
+        } else {
+            stats.inline_leaves++;
+        }
+
+        TSSymbol symbol = ts_subtree_symbol(subtree);
+        bool visible = ts_subtree_visible(subtree);
+        bool named = ts_subtree_named(subtree);
+        stats.nodes++;
+        stats.bytes += bytes;
+        if (visible) stats.visible_nodes++;
+        if (visible && named) stats.named_nodes++;
+        TypeStats &type = stats.types[{ts_language_symbol_name(language, symbol), named}];
+        type.visible = visible;
+        type.named = named;
+        type.nodes++;
+        type.bytes += bytes;
+    }
+}
+
+int main(int argc, char **argv) {
+    bool block = false;
+    bool all = false;
+    const char *file = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--block") == 0) {
+            block = true;
+        } else if (strcmp(argv[i], "--all") == 0) {
+            all = true;
+        } else {
+            file = argv[i];
+        }
+    }
+    if (!file) {
+        fprintf(stderr, "usage: %s [--block] [--all] <file>\n", argv[0]);
+        return 1;
+    }
+    string document = bench::read_file(file);
+
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, block ? tree_sitter_markdown_block() : tree_sitter_markdown());
+    TSTree *tree = ts_parser_parse_string(parser, NULL, document.data(), document.size());
+    TreeStats stats = TreeStats();
+    profile(tree, stats);
+
+    // Visible types that do not occur are listed with zero counts
+    if (all) {
+        for (const auto &type : node_types(block ? "block/src/node-types.json" : "src/node-types.json")) {
+            if (!stats.types.count(type)) stats.types[type] = {true, type.second, 0, 0};
+        }
+    }
+
+    double bytes = document.size() ? document.size() : 1;
+    printf("%s: %zu bytes, %s grammar\n\n", file, document.size(), block ? "block" : "full");
+    printf(
+        "nodes:           %10zu  (%.3f per byte)\n",
+        stats.nodes,
+        stats.nodes / bytes
+    );
+    printf(
+        "  visible:       %10zu  (%zu named, %zu anonymous)\n",
+        stats.visible_nodes,
+        stats.named_nodes,
+        stats.visible_nodes - stats.named_nodes
+    );
+    printf("  hidden:        %10zu\n", stats.nodes - stats.visible_nodes);
+    printf("  inline leaves: %10zu\n", stats.inline_leaves);
+    printf("  heap nodes:    %10zu\n", stats.heap_nodes);
+    printf(
+        "tree memory:     %10zu  bytes (%.2f per input byte)\n",
+        stats.bytes,
+        stats.bytes / bytes
+    );
+    printf(
+        "scanner states:  %10zu  external tokens, %zu stored out-of-line (%zu bytes)\n\n",
+        stats.external_tokens,
+        stats.heap_states,
+        stats.heap_state_bytes
+    );
+
+    // Visible types first, then hidden ones, each by descending memory
+    vector<std::pair<std::pair<string, bool>, TypeStats>> types(
+        stats.types.begin(),
+        stats.types.end()
+    );
+    std::stable_sort(types.begin(), types.end(), [](
+        const std::pair<std::pair<string, bool>, TypeStats> &a,
+        const std::pair<std::pair<string, bool>, TypeStats> &b
+    ) {
+        if (a.second.visible != b.second.visible) return a.second.visible;
+        return a.second.bytes > b.second.bytes ||
+            (a.second.bytes == b.second.bytes && a.second.nodes > b.second.nodes);
+    });
+    printf(
+        "%-44s %-10s %10s %8s %12s %8s\n",
+        "type", "kind", "nodes", "share", "bytes", "share"
+    );
+    for (const auto &type : types) {
+        const TypeStats &s = type.second;
+        string name = type.first.second ? type.first.first : "\"" + type.first.first + "\"";
+        printf(
+            "%-44s %-10s %10zu %7.2f%% %12zu %7.2f%%\n",
+            name.c_str(),
+            s.visible ? (s.named ? "named" : "anonymous") : "hidden",
+            s.nodes,
+            stats.nodes ? 100.0 * s.nodes / stats.nodes : 0.0,
+            s.bytes,
+            stats.bytes ? 100.0 * s.bytes / stats.bytes : 0.0
+        );
+    }
+
+    ts_tree_delete(tree);
+    ts_parser_delete(parser);
+    return 0;
+}
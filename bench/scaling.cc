@@ -0,0 +1,132 @@
+// Scaling benchmark for parallel batch parsing with `native/batch.h`.
+//
+// Parses a batch of documents with 1, 2, 4, ... up to N worker threads and reports throughput,
+// the speedup over a single thread and the parallel efficiency (speedup per thread). The batch
+// consists of the examples of `corpus/spec.txt` and synthetic documents of mixed sizes, so workers
+// finish their share at different times and have to steal, or of the files given on the command
+// line.
+//
+// Build (after `tree-sitter generate` in the root and `block` directories, against an installed
+// tree-sitter runtime):
+//
+//     cc -O2 -std=c99 -Isrc -c src/parser.c -o parser.o
+//     cc -O2 -std=c99 -Iblock/src -c block/src/parser.c -o block_parser.o
+//     SOURCES="bench/scaling.cc native/batch.cc src/scanner.cc block/src/scanner.cc"
+//     c++ -O2 -std=c++11 -pthread -Isrc $SOURCES parser.o block_parser.o -ltree-sitter -o scaling
+//
+// Usage:
+//
+//     ./scaling [--threads <N>] [--size <MB>] [--iterations <n>] [--block] [files...]
+//
+// `N` defaults to the number of hardware threads and `--size` is the total size of the synthetic
+// documents. The best of `--iterations` runs is reported for every thread count.
+
+#include "bench.h"
+#include <atomic>
+#include <thread>
+#include "../native/batch.h"
+
+// Only counts failures, so the measurement is not dominated by the sink
+class CountingSink : public markdown::Sink {
+  public:
+    std::atomic<size_t> failures;
+
+    CountingSink() : failures(0) {}
+
+    void consume(const markdown::BatchResult &result) override {
+        if (!result.tree) failures++;
+    }
+};
+
+int main(int argc, char **argv) {
+    unsigned max_threads = std::thread::hardware_concurrency();
+    size_t size = 64;
+    int iterations = 3;
+    markdown::BatchOptions options = markdown::BatchOptions();
+    vector<string> files;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            max_threads = strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            size = strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--block") == 0) {
+            options.language = tree_sitter_markdown_block();
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+    if (max_threads == 0) max_threads = 1;
+    size *= 1024 * 1024;
+
+    vector<string> documents;
+    if (files.empty()) {
+        documents = bench::corpus_examples("corpus/spec.txt");
+        // Sizes from 1 KB to 1 MB in a repeating pattern, a quarter of the total for every kind
+        size_t sizes[] = {1024, 16 * 1024, 4 * 1024, 256 * 1024, 64 * 1024, 1024 * 1024};
+        string (*generators[])(size_t) = {
+            bench::synthetic_readme,
+            bench::synthetic_deep_lists,
+            bench::synthetic_code_heavy,
+            bench::synthetic_emphasis_heavy,
+        };
+        for (auto generator : generators) {
+            size_t total = 0;
+            for (size_t i = 0; total < size / 4; i++) {
+                documents.push_back(generator(sizes[i % (sizeof(sizes) / sizeof(sizes[0]))]));
+                total += documents.back().size();
+            }
+        }
+    } else {
+        for (const string &file : files) documents.push_back(bench::read_file(file));
+    }
+    size_t bytes = 0;
+    vector<markdown::BatchInput> inputs;
+    for (size_t i = 0; i < documents.size(); i++) {
+        inputs.push_back(markdown::BatchInput::buffer(
+            std::to_string(i),
+            documents[i].data(),
+            documents[i].size()
+        ));
+        bytes += documents[i].size();
+    }
+
+    vector<unsigned> thread_counts;
+    for (unsigned threads = 1; threads < max_threads; threads *= 2) thread_counts.push_back(threads);
+    thread_counts.push_back(max_threads);
+
+    printf(
+        "%zu documents, %.2f MB\n\n%8s %10s %10s %12s %9s %11s %8s\n",
+        inputs.size(),
+        bytes / (1024.0 * 1024.0),
+        "threads", "seconds", "MB/s", "documents/s", "speedup", "efficiency", "steals"
+    );
+    double baseline = 0;
+    for (unsigned threads : thread_counts) {
+        options.threads = threads;
+        markdown::BatchStats best = markdown::BatchStats();
+        for (int i = 0; i < iterations; i++) {
+            CountingSink sink;
+            markdown::BatchStats stats = markdown::parse_batch(inputs, sink, options);
+            if (sink.failures > 0) {
+                fprintf(stderr, "%zu documents failed\n", (size_t)sink.failures);
+                return 1;
+            }
+            if (i == 0 || stats.seconds < best.seconds) best = stats;
+        }
+        if (threads == 1) baseline = best.seconds;
+        double speedup = baseline / best.seconds;
+        printf(
+            "%8u %10.3f %10.2f %12.0f %9.2f %10.0f%% %8zu\n",
+            threads,
+            best.seconds,
+            best.bytes / (1024.0 * 1024.0) / best.seconds,
+            best.documents / best.seconds,
+            speedup,
+            100 * speedup / threads,
+            best.steals
+        );
+    }
+    return 0;
+}
@@ -0,0 +1,161 @@
+// Throughput benchmark for the markdown parser.
+//
+// Parses the examples of `corpus/spec.txt`, a set of large synthetic documents and any files given
+// on the command line, and reports parse speed in MB/s, nodes per input byte and the peak resident
+// set size of the process.
+//
+// Every workload is parsed in several modes:
+//
+// * `full`: with the full markdown grammar
+// * `block`: with the block grammar only, as needed by viewers that only use document structure
+// * `two-phase`: with the block grammar, followed by the inline grammar for every `inline` node
+// * `viewport`: with the block grammar, followed by the inline grammar for the `inline` nodes in a
+//   64 KB window in the middle of the document
+//
+// Build (after running `tree-sitter generate` in the root, `block` and `inline` directories,
+// against an installed tree-sitter runtime):
+//
+//     cc -O2 -std=c99 -Isrc -c src/parser.c -o parser.o
+//     cc -O2 -std=c99 -Iblock/src -c block/src/parser.c -o block_parser.o
+//     cc -O2 -std=c99 -Iinline/src -c inline/src/parser.c -o inline_parser.o
+//     SOURCES="bench/throughput.cc src/scanner.cc block/src/scanner.cc inline/src/scanner.cc"
+//     OBJECTS="parser.o block_parser.o inline_parser.o"
+//     c++ -O2 -std=c++11 -Isrc $SOURCES $OBJECTS -ltree-sitter -o throughput
+//
+// Usage:
+//
+//     ./throughput [--size <MB>] [--iterations <n>] [--only <workload>] [--mode <mode>] [files...]
+//
+// Peak RSS is a process wide high water mark. Use `--only` and `--mode` to measure a single
+// workload and mode per run.
+
+#include "bench.h"
+
+struct Workload {
+    string name;
+    vector<string> documents;
+};
+
+struct Result {
+    size_t bytes;
+    size_t nodes;
+    double seconds;
+};
+
+struct Parsers {
+    TSParser *full;
+    TSParser *block;
+    TSParser *inline_;
+};
+
+const char *MODES[] = {"full", "block", "two-phase", "viewport"};
+const uint32_t VIEWPORT_SIZE = 64 * 1024;
+
+// Parse a document in the given mode. Returns the number of nodes of all resulting trees if
+// `count` is set and 0 otherwise.
+static size_t parse(Parsers &parsers, const string &document, const string &mode, bool count) {
+    if (mode == "full") {
+        TSTree *tree = ts_parser_parse_string(parsers.full, NULL, document.data(), document.size());
+        size_t nodes = count ? bench::count_nodes(tree) : 0;
+        ts_tree_delete(tree);
+        return nodes;
+    }
+    TSTree *tree = ts_parser_parse_string(parsers.block, NULL, document.data(), document.size());
+    size_t nodes = count ? bench::count_nodes(tree) : 0;
+    if (mode != "block") {
+        uint32_t start = 0;
+        uint32_t end = document.size();
+        if (mode == "viewport" && document.size() > VIEWPORT_SIZE) {
+            start = (document.size() - VIEWPORT_SIZE) / 2;
+            end = start + VIEWPORT_SIZE;
+        }
+        vector<TSNode> inlines;
+        bench::collect_inline_nodes(ts_tree_root_node(tree), start, end, inlines);
+        for (TSNode node : inlines) {
+            TSTree *inline_tree = bench::parse_inline(parsers.inline_, document, node);
+            if (!inline_tree) continue;
+            if (count) nodes += bench::count_nodes(inline_tree);
+            ts_tree_delete(inline_tree);
+        }
+    }
+    ts_tree_delete(tree);
+    return nodes;
+}
+
+static Result run(Parsers &parsers, const Workload &workload, const string &mode, int iterations) {
+    Result result = {0, 0, 0};
+    for (int i = 0; i < iterations; i++) {
+        for (const string &document : workload.documents) {
+            double start = bench::now();
+            parse(parsers, document, mode, false);
+            result.seconds += bench::now() - start;
+            result.bytes += document.size();
+            if (i == 0) result.nodes += parse(parsers, document, mode, true);
+        }
+    }
+    return result;
+}
+
+int main(int argc, char **argv) {
+    size_t size = 10;
+    int iterations = 1;
+    const char *only = NULL;
+    const char *only_mode = NULL;
+    vector<string> files;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            size = strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            iterations = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--only") == 0 && i + 1 < argc) {
+            only = argv[++i];
+        } else if (strcmp(argv[i], "--mode") == 0 && i + 1 < argc) {
+            only_mode = argv[++i];
+        } else {
+            files.push_back(argv[i]);
+        }
+    }
+    size *= 1024 * 1024;
+
+    vector<Workload> workloads;
+    workloads.push_back({"spec", bench::corpus_examples("corpus/spec.txt")});
+    workloads.push_back({"readme", {bench::synthetic_readme(size)}});
+    workloads.push_back({"deep-lists", {bench::synthetic_deep_lists(size)}});
+    workloads.push_back({"code-heavy", {bench::synthetic_code_heavy(size)}});
+    workloads.push_back({"emphasis-heavy", {bench::synthetic_emphasis_heavy(size)}});
+    for (const string &file : files) {
+        workloads.push_back({file, {bench::read_file(file)}});
+    }
+
+    Parsers parsers = {ts_parser_new(), ts_parser_new(), ts_parser_new()};
+    ts_parser_set_language(parsers.full, tree_sitter_markdown());
+    ts_parser_set_language(parsers.block, tree_sitter_markdown_block());
+    ts_parser_set_language(parsers.inline_, tree_sitter_markdown_inline());
+
+    printf(
+        "%-20s %-10s %12s %10s %12s %14s\n",
+        "workload", "mode", "bytes", "MB/s", "nodes/byte", "peak RSS (KB)"
+    );
+    for (const Workload &workload : workloads) {
+        if (only && workload.name != only) continue;
+        for (const char *mode : MODES) {
+            if (only_mode && strcmp(mode, only_mode) != 0) continue;
+            Result result = run(parsers, workload, mode, iterations);
+            double megabytes = result.bytes / (1024.0 * 1024.0);
+            printf(
+                "%-20s %-10s %12zu %10.2f %12.3f %14ld\n",
+                workload.name.c_str(),
+                mode,
+                result.bytes / iterations,
+                megabytes / result.seconds,
+                (double)result.nodes / (result.bytes / iterations),
+                bench::peak_rss_kb()
+            );
+        }
+    }
+
+    ts_parser_delete(parsers.full);
+    ts_parser_delete(parsers.block);
+    ts_parser_delete(parsers.inline_);
+    return 0;
+}
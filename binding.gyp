@@ -9,7 +9,11 @@
       "sources": [
         "bindings/node/binding.cc",
         "src/parser.c",
-        "src/scanner.cc"
+        "src/scanner.cc",
+        "block/src/parser.c",
+        "block/src/scanner.cc",
+        "inline/src/parser.c",
+        "inline/src/scanner.cc"
       ],
       "cflags_c": [
         "-std=c99",
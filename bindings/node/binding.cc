@@ -5,21 +5,33 @@
 using namespace v8;
 
 extern "C" TSLanguage * tree_sitter_markdown();
+extern "C" TSLanguage * tree_sitter_markdown_block();
+extern "C" TSLanguage * tree_sitter_markdown_inline();
 
 namespace {
 
 NAN_METHOD(New) {}
 
+Local<Object> NewLanguage(Local<Function> constructor, TSLanguage *language, const char *name) {
+  Local<Object> instance = constructor->NewInstance(Nan::GetCurrentContext()).ToLocalChecked();
+  Nan::SetInternalFieldPointer(instance, 0, language);
+  Nan::Set(instance, Nan::New("name").ToLocalChecked(), Nan::New(name).ToLocalChecked());
+  return instance;
+}
+
 void Init(Local<Object> exports, Local<Object> module) {
   Local<FunctionTemplate> tpl = Nan::New<FunctionTemplate>(New);
   tpl->SetClassName(Nan::New("Language").ToLocalChecked());
   tpl->InstanceTemplate()->SetInternalFieldCount(1);
 
   Local<Function> constructor = Nan::GetFunction(tpl).ToLocalChecked();
-  Local<Object> instance = constructor->NewInstance(Nan::GetCurrentContext()).ToLocalChecked();
-  Nan::SetInternalFieldPointer(instance, 0, tree_sitter_markdown());
+  Local<Object> instance = NewLanguage(constructor, tree_sitter_markdown(), "markdown");
 
-  Nan::Set(instance, Nan::New("name").ToLocalChecked(), Nan::New("markdown").ToLocalChecked());
+  // The grammars for two phase parsing: block structure first and inline contents on demand.
+  Nan::Set(instance, Nan::New("block").ToLocalChecked(),
+    NewLanguage(constructor, tree_sitter_markdown_block(), "markdown_block"));
+  Nan::Set(instance, Nan::New("inline").ToLocalChecked(),
+    NewLanguage(constructor, tree_sitter_markdown_inline(), "markdown_inline"));
   Nan::Set(module, Nan::New("exports").ToLocalChecked(), instance);
 }
 
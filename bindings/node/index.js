@@ -16,4 +16,6 @@ try {
 
 try {
   module.exports.nodeTypeInfo = require("../../src/node-types.json");
+  module.exports.block.nodeTypeInfo = require("../../block/src/node-types.json");
+  module.exports.inline.nodeTypeInfo = require("../../inline/src/node-types.json");
 } catch (_) {}
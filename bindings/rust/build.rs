@@ -9,12 +9,19 @@ fn main() {
         .flag_if_supported("-Wno-trigraphs");
     let parser_path = src_dir.join("parser.c");
     c_config.file(&parser_path);
+    // The block and inline grammars used for two phase parsing
+    let block_parser_path = std::path::Path::new("block/src/parser.c");
+    c_config.file(&block_parser_path);
+    let inline_parser_path = std::path::Path::new("inline/src/parser.c");
+    c_config.file(&inline_parser_path);
 
     // If your language uses an external scanner written in C,
     // then include this block of code:
 
     c_config.compile("parser");
     println!("cargo:rerun-if-changed={}", parser_path.to_str().unwrap());
+    println!("cargo:rerun-if-changed={}", block_parser_path.to_str().unwrap());
+    println!("cargo:rerun-if-changed={}", inline_parser_path.to_str().unwrap());
 
     let mut cpp_config = cc::Build::new();
     cpp_config.cpp(true);
@@ -24,6 +31,8 @@ fn main() {
         .flag_if_supported("-Wno-unused-but-set-variable");
     let scanner_path = src_dir.join("scanner.cc");
     cpp_config.file(&scanner_path);
+    cpp_config.file("block/src/scanner.cc");
+    cpp_config.file("inline/src/scanner.cc");
     cpp_config.compile("scanner");
     println!("cargo:rerun-if-changed={}", scanner_path.to_str().unwrap());
 }
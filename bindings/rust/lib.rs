@@ -19,6 +19,8 @@ use tree_sitter::Language;
 
 extern "C" {
     fn tree_sitter_markdown() -> Language;
+    fn tree_sitter_markdown_block() -> Language;
+    fn tree_sitter_markdown_inline() -> Language;
 }
 
 /// Get the tree-sitter [Language][] for this grammar.
@@ -28,11 +30,40 @@ pub fn language() -> Language {
     unsafe { tree_sitter_markdown() }
 }
 
+/// Get the tree-sitter [Language][] for the block structure of markdown documents.
+///
+/// The contents of paragraphs and headings are exposed as `inline` nodes, which can be parsed with
+/// [inline_language][] by setting their ranges (without `block_quote_marker` children) as the
+/// included ranges of the parser.
+///
+/// [Language]: https://docs.rs/tree-sitter/*/tree_sitter/struct.Language.html
+/// [inline_language]: fn.inline_language.html
+pub fn block_language() -> Language {
+    unsafe { tree_sitter_markdown_block() }
+}
+
+/// Get the tree-sitter [Language][] for the inline contents of paragraphs and headings.
+///
+/// [Language]: https://docs.rs/tree-sitter/*/tree_sitter/struct.Language.html
+pub fn inline_language() -> Language {
+    unsafe { tree_sitter_markdown_inline() }
+}
+
 /// The content of the [`node-types.json`][] file for this grammar.
 ///
 /// [`node-types.json`]: https://tree-sitter.github.io/tree-sitter/using-parsers#static-node-types
 pub const NODE_TYPES: &'static str = include_str!("../../src/node-types.json");
 
+/// The content of the [`node-types.json`][] file for the block grammar.
+///
+/// [`node-types.json`]: https://tree-sitter.github.io/tree-sitter/using-parsers#static-node-types
+pub const BLOCK_NODE_TYPES: &'static str = include_str!("../../block/src/node-types.json");
+
+/// The content of the [`node-types.json`][] file for the inline grammar.
+///
+/// [`node-types.json`]: https://tree-sitter.github.io/tree-sitter/using-parsers#static-node-types
+pub const INLINE_NODE_TYPES: &'static str = include_str!("../../inline/src/node-types.json");
+
 // Uncomment these to include any queries that this grammar contains
 
 // pub const HIGHLIGHTS_QUERY: &'static str = include_str!("../../queries/highlights.scm");
@@ -49,4 +80,15 @@ mod tests {
             .set_language(super::language())
             .expect("Error loading markdown language");
     }
+
+    #[test]
+    fn test_can_load_block_and_inline_grammars() {
+        let mut parser = tree_sitter::Parser::new();
+        parser
+            .set_language(super::block_language())
+            .expect("Error loading markdown block language");
+        parser
+            .set_language(super::inline_language())
+            .expect("Error loading markdown inline language");
+    }
 }
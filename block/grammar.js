@@ -0,0 +1,37 @@
+// A grammar for only the block structure of markdown.
+//
+// This grammar inherits all rules from the full markdown grammar in `../grammar.js`, but does not
+// parse the contents of paragraphs and headings. Instead they are tokenized into plain words,
+// whitespace and punctuation and exposed as `inline` nodes. This avoids the many inline rules
+// generated by `add_inline_rules` (and their conflicts), which make up most of the parse table.
+//
+// The contents of `inline` nodes can be parsed on demand using the grammar in `../inline`. Use the
+// range of the `inline` node, minus any `block_quote_marker` children, as the included ranges of
+// the inline parser.
+
+const markdown = require('../grammar');
+
+module.exports = grammar(markdown, {
+    name: 'markdown_block',
+
+    conflicts: ($, original) => original.concat([
+        [$.link_reference_definition, $._text],
+        [$.link_label, $._text],
+    ]),
+
+    rules: {
+        atx_heading: $ => prec(1, seq(
+            choice($.atx_h1_marker, $.atx_h2_marker, $.atx_h3_marker, $.atx_h4_marker, $.atx_h5_marker, $.atx_h6_marker),
+            optional(alias($._atx_heading_content, $.heading_content)),
+            $._newline
+        )),
+        _atx_heading_content: $ => alias($._inline_no_newline, $.inline),
+
+        paragraph: $ => seq(alias($._inline, $.inline), $._newline),
+
+        // Inline contents are not parsed any further. Soft line breaks still have to be parsed as
+        // they decide whether the next line continues the paragraph.
+        _inline_element: $ => choice($._text_run, $._text, $._soft_line_break),
+        _inline_element_no_newline: $ => choice($._text_run, $._text),
+    },
+});
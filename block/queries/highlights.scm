@@ -0,0 +1,23 @@
+[
+  (atx_heading)
+  (setext_heading)
+] @text.title
+
+(code_fence_content) @none
+
+[
+  (indented_code_block)
+  (fenced_code_block)
+] @text.literal
+
+(link_destination) @text.uri
+
+(link_label) @text.reference
+
+[
+  (list_marker_plus)
+  (list_marker_minus)
+  (list_marker_star)
+  (list_marker_dot)
+  (list_marker_parenthesis)
+] @punctuation.special
@@ -0,0 +1,8 @@
+(fenced_code_block
+  (info_string
+    (language) @language)
+  (code_fence_content) @content)
+
+((html_block) @html)
+
+((inline) @markdown_inline)
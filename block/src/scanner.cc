@@ -0,0 +1,4 @@
+// The block grammar uses the same external tokens as the full markdown grammar, so it also uses the
+// same external scanner.
+#define EXTERNAL_SCANNER(function) tree_sitter_markdown_block_external_scanner_##function
+#include "../../src/scanner.cc"
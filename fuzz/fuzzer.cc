@@ -0,0 +1,308 @@
+// libFuzzer target for the external scanner.
+//
+// Every input is parsed as a document with the full, the block and the inline grammar, so the
+// external scanner is driven by real parsers with all the combinations of valid symbols they
+// produce. Besides crashes and sanitizer reports the following count as findings:
+//
+// * performance cliffs: the full grammar takes longer than `microseconds_per_byte` per input byte
+//   plus `microseconds_base` to parse the input, twice in a row to rule out noise
+// * a scanner state that does not fit into tree-sitter's serialization buffer or that changes on
+//   a round trip through `deserialize` and `serialize`
+// * an incremental reparse after a few edits derived from the input that results in a different
+//   tree than parsing the edited document from scratch, unless the document has errors
+// * a prefix of the input that, deserialized as a scanner state and serialized again, does not
+//   stay the same on a second round trip. Tree-sitter only passes states written by `serialize`,
+//   but `deserialize` must not trust its input.
+//
+// Build with clang (after `tree-sitter generate` in the root, `block` and `inline` directories),
+// against the tree-sitter runtime compiled with the same sanitizers:
+//
+//     FLAGS="-O1 -g -fsanitize=address,undefined,fuzzer-no-link"
+//     RUNTIME="-I$TREE_SITTER/lib/include -I$TREE_SITTER/lib/src"
+//     clang $FLAGS -std=c99 $RUNTIME -c $TREE_SITTER/lib/src/lib.c -o lib.o
+//     clang $FLAGS -std=c99 -Isrc -c src/parser.c -o parser.o
+//     clang $FLAGS -std=c99 -Iblock/src -c block/src/parser.c -o block_parser.o
+//     clang $FLAGS -std=c99 -Iinline/src -c inline/src/parser.c -o inline_parser.o
+//     SOURCES="fuzz/fuzzer.cc src/scanner.cc block/src/scanner.cc inline/src/scanner.cc"
+//     OBJECTS="parser.o block_parser.o inline_parser.o lib.o"
+//     LINK_FLAGS="-O1 -g -fsanitize=address,undefined,fuzzer"
+//     clang++ $LINK_FLAGS -std=c++11 -Isrc -I$TREE_SITTER/lib/include $SOURCES $OBJECTS -o fuzzer
+//
+// Usage, with a seed corpus made of the examples in `corpus/*.txt`:
+//
+//     node script/generate-fuzz-corpus.js fuzz/corpus
+//     ./fuzzer -max_len=4096 fuzz/corpus
+//
+// The time budget can be changed with the environment variables
+// `MARKDOWN_FUZZ_MICROSECONDS_PER_BYTE` and `MARKDOWN_FUZZ_MICROSECONDS_BASE`.
+
+#include <tree_sitter/api.h>
+#include <tree_sitter/parser.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using std::string;
+
+extern "C" const TSLanguage *tree_sitter_markdown();
+extern "C" const TSLanguage *tree_sitter_markdown_block();
+extern "C" const TSLanguage *tree_sitter_markdown_inline();
+
+// Time budget for parsing an input with the full grammar. These are placeholders that have not
+// been measured against a build of the parser yet, tune them with the environment variables above.
+static double microseconds_per_byte = 20;
+static double microseconds_base = 20000;
+
+// Number of edits applied to every input before the incremental reparse
+const size_t EDIT_COUNT = 4;
+// Maximum number of bytes removed or inserted by an edit
+const size_t EDIT_LENGTH = 16;
+// Text inserted by edits, besides copies of other parts of the input. These change the block
+// structure or open inline constructs.
+const char *const EDIT_SNIPPETS[] = {
+    "\n", "\n\n", "> ", "- ", "1. ", "    ", "\t", "*", "_", "`", "```\n", "[", "](", "<", "\\",
+};
+
+static TSParser *full_parser;
+static TSParser *block_parser;
+static TSParser *inline_parser;
+
+enum Grammar { FULL, BLOCK, INLINE, GRAMMAR_COUNT };
+
+// The functions of the external scanner of a grammar, each grammar compiles its own copy of it
+struct ScannerFunctions {
+    void *(*create)();
+    unsigned (*serialize)(void *, char *);
+    void (*deserialize)(void *, const char *, unsigned);
+    // A scanner that every serialized state is loaded into to check the round trip
+    void *shadow;
+};
+
+static TSLanguage languages[GRAMMAR_COUNT];
+static ScannerFunctions scanners[GRAMMAR_COUNT];
+
+static void finding(const char *format, ...) __attribute__((format(printf, 1, 2), noreturn));
+
+static void finding(const char *format, ...) {
+    va_list arguments;
+    va_start(arguments, format);
+    fprintf(stderr, "==markdown-fuzzer== ");
+    vfprintf(stderr, format, arguments);
+    fprintf(stderr, "\n");
+    va_end(arguments);
+    abort();
+}
+
+static double now_microseconds() {
+    using namespace std::chrono;
+    return duration<double, std::micro>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Loads `buffer` into the shadow scanner of `scanner` and serializes it again into `copy`
+static unsigned round_trip(
+    const ScannerFunctions &scanner,
+    const char *buffer,
+    unsigned length,
+    char *copy
+) {
+    scanner.deserialize(scanner.shadow, buffer, length);
+    return scanner.serialize(scanner.shadow, copy);
+}
+
+// Wraps the serialize function of the external scanner of `grammar` to check every state the
+// parser stores
+template <Grammar grammar>
+static unsigned checked_serialize(void *payload, char *buffer) {
+    const ScannerFunctions &scanner = scanners[grammar];
+    unsigned length = scanner.serialize(payload, buffer);
+    if (length > TREE_SITTER_SERIALIZATION_BUFFER_SIZE) {
+        finding("scanner state of %u bytes does not fit into the serialization buffer", length);
+    }
+    char copy[TREE_SITTER_SERIALIZATION_BUFFER_SIZE];
+    unsigned copy_length = round_trip(scanner, buffer, length, copy);
+    if (copy_length != length || memcmp(copy, buffer, length) != 0) {
+        finding("scanner state of %u bytes changed to %u bytes on a round trip", length, copy_length);
+    }
+    return length;
+}
+
+// Copies `language` into `languages`, with its scanner states checked by `checked_serialize`
+template <Grammar grammar>
+static const TSLanguage *instrument(const TSLanguage *language) {
+    ScannerFunctions &scanner = scanners[grammar];
+    scanner.create = language->external_scanner.create;
+    scanner.serialize = language->external_scanner.serialize;
+    scanner.deserialize = language->external_scanner.deserialize;
+    scanner.shadow = scanner.create();
+    languages[grammar] = *language;
+    languages[grammar].external_scanner.serialize = checked_serialize<grammar>;
+    return &languages[grammar];
+}
+
+static TSParser *new_parser(const TSLanguage *language) {
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, language);
+    return parser;
+}
+
+static string tree_string(TSTree *tree) {
+    char *sexp = ts_node_string(ts_tree_root_node(tree));
+    string result = sexp;
+    free(sexp);
+    return result;
+}
+
+// Parse `document` with the full grammar and check the time it took against the budget
+static TSTree *timed_parse(const string &document) {
+    double budget = microseconds_base + microseconds_per_byte * document.size();
+    ts_parser_set_timeout_micros(full_parser, (uint64_t)(4 * budget));
+    double elapsed = 0;
+    TSTree *tree = NULL;
+    for (int attempt = 0; attempt < 2; attempt++) {
+        ts_tree_delete(tree);
+        double start = now_microseconds();
+        tree = ts_parser_parse_string(full_parser, NULL, document.data(), document.size());
+        elapsed = now_microseconds() - start;
+        if (!tree) {
+            finding("parsing %zu bytes timed out after %.0f us", document.size(), elapsed);
+        }
+        if (elapsed <= budget) break;
+    }
+    if (elapsed > budget) {
+        finding(
+            "parsing %zu bytes took %.0f us, %.2f us per byte",
+            document.size(),
+            elapsed,
+            elapsed / document.size()
+        );
+    }
+    ts_parser_set_timeout_micros(full_parser, 0);
+    return tree;
+}
+
+// The row and column of a byte offset
+static TSPoint point_at(const string &text, size_t byte) {
+    TSPoint point = {0, 0};
+    for (size_t i = 0; i < byte; i++) {
+        if (text[i] == '\n') {
+            point.row++;
+            point.column = 0;
+        } else {
+            point.column++;
+        }
+    }
+    return point;
+}
+
+// A small pseudo random number generator, seeded from the input so findings are reproducible
+struct Random {
+    uint64_t state;
+
+    uint64_t next() {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        return state >> 33;
+    }
+
+    size_t below(size_t bound) {
+        return bound == 0 ? 0 : next() % bound;
+    }
+};
+
+// Apply `EDIT_COUNT` edits to `document` one at a time, each followed by an incremental reparse,
+// and compare the result with a parse of the edited document from scratch.
+static void check_incremental(string document, TSTree *tree, Random &random) {
+    const string original = document;
+    for (size_t i = 0; i < EDIT_COUNT; i++) {
+        size_t start = random.below(document.size() + 1);
+        size_t removed = random.below(std::min(EDIT_LENGTH, document.size() - start) + 1);
+        string inserted;
+        size_t snippet = random.below(sizeof(EDIT_SNIPPETS) / sizeof(EDIT_SNIPPETS[0]) + 1);
+        if (snippet < sizeof(EDIT_SNIPPETS) / sizeof(EDIT_SNIPPETS[0])) {
+            inserted = EDIT_SNIPPETS[snippet];
+        } else {
+            size_t from = random.below(original.size() + 1);
+            inserted = original.substr(from, random.below(EDIT_LENGTH + 1));
+        }
+
+        TSInputEdit edit;
+        edit.start_byte = start;
+        edit.old_end_byte = start + removed;
+        edit.new_end_byte = start + inserted.size();
+        edit.start_point = point_at(document, edit.start_byte);
+        edit.old_end_point = point_at(document, edit.old_end_byte);
+        document.replace(start, removed, inserted);
+        edit.new_end_point = point_at(document, edit.new_end_byte);
+
+        ts_tree_edit(tree, &edit);
+        TSTree *new_tree =
+            ts_parser_parse_string(full_parser, tree, document.data(), document.size());
+        ts_tree_delete(tree);
+        tree = new_tree;
+    }
+
+    TSTree *expected = ts_parser_parse_string(full_parser, NULL, document.data(), document.size());
+    // Error recovery may legitimately differ between an incremental and a full parse
+    if (!ts_node_has_error(ts_tree_root_node(expected))) {
+        string incremental = tree_string(tree);
+        string full = tree_string(expected);
+        if (incremental != full) {
+            finding(
+                "incremental parse differs from full parse\n  incremental: %s\n  full: %s",
+                incremental.c_str(),
+                full.c_str()
+            );
+        }
+    }
+    ts_tree_delete(expected);
+    ts_tree_delete(tree);
+}
+
+// Deserialize a prefix of the input as a scanner state of every grammar. Whatever state comes out
+// of it has to survive a further round trip unchanged.
+static void check_deserialize(const uint8_t *data, size_t size) {
+    unsigned length = std::min(size, (size_t)TREE_SITTER_SERIALIZATION_BUFFER_SIZE);
+    char first[TREE_SITTER_SERIALIZATION_BUFFER_SIZE];
+    char second[TREE_SITTER_SERIALIZATION_BUFFER_SIZE];
+    for (const ScannerFunctions &scanner : scanners) {
+        unsigned first_length = round_trip(scanner, (const char *)data, length, first);
+        unsigned second_length = round_trip(scanner, first, first_length, second);
+        if (first_length != second_length || memcmp(first, second, first_length) != 0) {
+            finding("deserialized state of %u bytes is not stable", length);
+        }
+    }
+}
+
+extern "C" int LLVMFuzzerInitialize(int *, char ***) {
+    if (const char *value = getenv("MARKDOWN_FUZZ_MICROSECONDS_PER_BYTE")) {
+        microseconds_per_byte = atof(value);
+    }
+    if (const char *value = getenv("MARKDOWN_FUZZ_MICROSECONDS_BASE")) {
+        microseconds_base = atof(value);
+    }
+
+    full_parser = new_parser(instrument<FULL>(tree_sitter_markdown()));
+    block_parser = new_parser(instrument<BLOCK>(tree_sitter_markdown_block()));
+    inline_parser = new_parser(instrument<INLINE>(tree_sitter_markdown_inline()));
+    return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    string document((const char *)data, size);
+
+    check_deserialize(data, size);
+
+    TSTree *tree = timed_parse(document);
+    ts_tree_delete(ts_parser_parse_string(block_parser, NULL, document.data(), document.size()));
+    ts_tree_delete(ts_parser_parse_string(inline_parser, NULL, document.data(), document.size()));
+
+    // FNV-1a hash of the input as the seed for the edits
+    Random random = {14695981039346656037ull};
+    for (size_t i = 0; i < size; i++) random.state = (random.state ^ data[i]) * 1099511628211ull;
+    check_incremental(document, tree, random);
+    return 0;
+}
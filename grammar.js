@@ -12,7 +12,6 @@
 // maginuted of these values should be increased in the future
 const PRECEDENCE_LEVEL_EMPHASIS = 1;
 const PRECEDENCE_LEVEL_LINK = 10;
-const PRECEDENCE_LEVEL_HTML = 100;
 const PRECEDENCE_LEVEL_CODE_SPAN = 100;
 
 // Punctuation characters as specified in
@@ -23,19 +22,6 @@ const PUNCTUATION_CHARACTERS_ARRAY = [
     '=', '>', '?', '@', '[', '\\', ']', '^', '_', '`', '{', '|', '}', '~'
 ];
 
-// (https://github.github.com/gfm/#html-blocks)
-// tag names for html blocks of type 1
-const HTML_TAG_NAMES_RULE_1 = ['pre', 'script', 'style'];
-// tag names for html blocks of type 6
-const HTML_TAG_NAMES_RULE_7 = [
-    'address', 'article', 'aside', 'base', 'basefont', 'blockquote', 'body', 'caption', 'center',
-    'col', 'colgroup', 'dd', 'details', 'dialog', 'dir', 'div', 'dl', 'dt', 'fieldset', 'figcaption',
-    'figure', 'footer', 'form', 'frame', 'frameset', 'h1', 'h2', 'h3', 'h4', 'h5', 'h6', 'head',
-    'header', 'hr', 'html', 'iframe', 'legend', 'li', 'link', 'main', 'menu', 'menuitem', 'nav',
-    'noframes', 'ol', 'optgroup', 'option', 'p', 'param', 'section', 'source', 'summary', 'table',
-    'tbody', 'td', 'tfoot', 'th', 'thead', 'title', 'tr', 'track', 'ul'
-];
-
 // !!!
 // Notice the call to `add_inline_rules` which generates some additional rules related to parsing
 // inline contents in different contexts.
@@ -56,7 +42,7 @@ module.exports = grammar(add_inline_rules({
         //
         // If we are not able to match all blocks that does not necessarily mean that all unmatched blocks
         // have to be closed. It could also mean that the line is a lazy continuation line
-        // (https://github.github.com/gfm/#lazy-continuation-line, see also `$._split_token` and
+        // (https://github.github.com/gfm/#lazy-continuation-line, see also
         // `$._soft_line_break_marker` below)
         //
         // If a block does get closed (because it was not matched or because some closing token was
@@ -102,6 +88,20 @@ module.exports = grammar(add_inline_rules({
         $._fenced_code_block_end_backtick,
         $._fenced_code_block_end_tilde,
 
+        // The contents of a line in a fenced code block or indented chunk up to the newline. Code
+        // is not parsed any further, so a whole line is a single token.
+        $._code_line,
+
+        // The first line of an html block. The external scanner decides which of the kinds of html
+        // blocks of the spec starts on the line (https://github.github.com/gfm/#html-blocks) and
+        // remembers it on its block stack.
+        $._html_block_start,
+        // The contents of a further line in an html block up to the newline. Html blocks of type 1
+        // to 5 end on the line that contains a specific string. The external scanner closes the
+        // block after that line. Html blocks of type 6 and 7 end at a blank line, which is parsed
+        // by the grammar.
+        $._html_block_line,
+
         // This is used in the case that a start token for a block is not parsed by the external
         // parser to properly update the currently open blocks in the external parser.
         $._open_block,
@@ -117,31 +117,68 @@ module.exports = grammar(add_inline_rules({
         // parsing a link reference definition.
         $._no_indented_chunk,
 
-        // Line breaks in paragraphs are of relevance for both block and inline structure if we encounter
-        // a newline inside a paragraph exactly two `$._split_token` are emitted by the external scanner.
-        // This way the current parser version gets split in two. In one of the resulting parse versions
-        // we then also emit a `$._soft_line_break_marker` to be able to differntiate the two versions.
-        $._split_token,
+        // Line breaks in paragraphs are of relevance for both block and inline structure. When the
+        // external scanner encounters a newline inside a paragraph it looks ahead at the next line
+        // to decide whether the paragraph goes on. If it does, the open blocks that match are
+        // followed by a `$._soft_line_break_marker` instead of `$._block_close` tokens for the
+        // others. See `$.paragraph`.
         $._soft_line_break_marker,
 
-        // An `$._error` token is never valid  and gets emmited to kill invalid parse branches. Concretely
-        // this is used to decide wether a newline closes a paragraph and together and it gets emitted
-        // when trying to parse the `$._trigger_error` token in `$.link_title`.
+        // An `$._error` token is never valid and gets emmited to kill invalid parse branches. It gets
+        // emitted when trying to parse the `$._trigger_error` token in `$.link_title`.
         $._error,
         $._trigger_error,
         
         // INLINE STRUCTURE
 
         // Opening and closing delimiters for code spans. These are sequences of one or more backticks.
-        // An opening token does not mean the text after has to be a code span if there is no closing token
+        // An opening token is only emitted if the external scanner found a closing token later in the
+        // paragraph. Backticks that can not open a code span are emitted as
+        // `$._unmatched_code_span_delimiter`, which is just text.
         $._code_span_start,
         $._code_span_close,
+        $._unmatched_code_span_delimiter,
 
-        // Opening and closing delimiters for emphasis.
+        // Opening and closing delimiters for emphasis. The external scanner matches delimiter runs
+        // itself, so an opening delimiter is only emitted if it will get closed. All other
+        // delimiters are emitted as `$._unmatched_emphasis_delimiter`, which is just text.
         $._emphasis_open_star,
         $._emphasis_open_underscore,
         $._emphasis_close_star,
         $._emphasis_close_underscore,
+        $._unmatched_emphasis_delimiter,
+
+        // Plain text up to the next character that could start an inline construct: words and the
+        // whitespace between them. A single token replaces the many `$._word` and `$._whitespace`
+        // tokens of a line of prose, which keeps inline trees small.
+        $._text_run,
+
+        // An html entity reference like `&amp;`. The external scanner looks the name up in a table
+        // generated from `html_entities.json`, see `script/generate-html-entities.js`.
+        $.entity_reference,
+
+        // Raw html, see `$.html_tag`. The external scanner checks that the html is complete before
+        // it emits anything, so a `<` that does not start html is plain punctuation right away.
+        // Html that spans several lines is emitted as one `$._html_tag_line` per line that does not
+        // contain its end, followed by `$._html_tag_end`.
+        $._html_tag_line,
+        $._html_tag_end,
+
+        // The brackets of links and images, see `$._link_text`. The external scanner only emits
+        // `$._link_open` (`[`) or `$._image_open` (`![`) if it finds the matching `]`. That `]` is
+        // emitted as one of the `$._link_close_*` tokens, depending on whether a destination, a
+        // label, an empty label or nothing follows it.
+        $._link_open,
+        $._image_open,
+        $._link_close_inline,
+        $._link_close_full_reference,
+        $._link_close_collapsed_reference,
+        $._link_close_shortcut,
+
+        // Text of a paragraph whose inline content is too long to be parsed in full, see
+        // `$._degraded_inline`. Runs up to the next code span delimiter, backslash escape or line
+        // ending.
+        $._degraded_text,
 
         // For emphasis we need to tell the parser if the last character was a whitespace (or the
         // beginning of a line) or a punctuation. These tokens never actually get emitted.
@@ -151,6 +188,7 @@ module.exports = grammar(add_inline_rules({
     precedences: $ => [
         [$.fenced_code_block, $._text],
         [$._inline_element, $.paragraph],
+        [$._degraded_inline_element, $.paragraph],
         [$.setext_heading, $._block],
         [$.indented_code_block, $._block],
         [$._strong_emphasis_star, $._inline_element_no_star],
@@ -164,23 +202,12 @@ module.exports = grammar(add_inline_rules({
     ],
     // More conflicts are defined in `add_inline_rules`
     conflicts: $ => [
-        [$.link_label, $._closing_tag, $._text_inline_no_link],
-        [$.link_label, $._open_tag, $._text_inline_no_link],
         [$.link_label, $.hard_line_break, $._text_inline_no_link],
         [$.link_label, $._inline_element_no_link],
-        [$._image_description, $._image_description_non_empty, $._text_inline],
-        [$._image_description, $._image_description_non_empty, $._text_inline_no_star],
-        [$._image_description, $._image_description_non_empty, $._text_inline_no_underscore],
-        [$._image_shortcut_link, $._image_description],
-        [$._image_inline_link, $._image_shortcut_link],
-        [$._image_full_reference_link, $._image_collapsed_reference_link, $._image_shortcut_link],
-        [$.shortcut_link, $._link_text],
         [$.link_destination, $.link_title],
         [$._link_destination_parenthesis, $.link_title],
-        [$._soft_line_break, $._paragraph_end_newline],
         [$.link_reference_definition],
         [$.hard_line_break, $._whitespace],
-        [$._link_text_non_empty, $.link_label],
     ],
     extras: $ => [],
 
@@ -204,34 +231,6 @@ module.exports = grammar(add_inline_rules({
             $.link_reference_definition,
         ),
 
-        // Just the blocks that are able to interrupt a paragraph.
-        // This should not end up in the actual output but is used to decide whether a newline
-        // is a lazy continuation.
-        _block_interrupt_paragraph: $ => choice(
-            $.atx_heading,
-            $.block_quote,
-            $.thematic_break,
-            choice( // some list items do not interrupt paragraphs
-                $._list_marker_plus,
-                $._list_marker_minus,
-                $._list_marker_star,
-                $._list_marker_dot,
-                $._list_marker_parenthesis,
-            ),
-            $.fenced_code_block,
-            $._blank_line,
-            choice( // _html_block_7 cannot interrupt a paragraph
-                $._html_block_1,
-                $._html_block_2,
-                $._html_block_3,
-                $._html_block_4,
-                $._html_block_5,
-                $._html_block_6,
-            ),
-            $.setext_h1_underline,
-            $.setext_h2_underline,
-        ),
-
         // LEAF BLOCKS
 
         // A thematic break. This is currently handled by the external scanner but maybe could be
@@ -265,7 +264,7 @@ module.exports = grammar(add_inline_rules({
         //
         // https://github.github.com/gfm/#indented-code-blocks
         indented_code_block: $ => prec.right(seq($._indented_chunk, repeat(choice($._indented_chunk, $._blank_line)))),
-        _indented_chunk: $ => seq($._indented_chunk_start, repeat(choice($._text, $._newline)), $._block_close, optional($._ignore_matching_tokens)),
+        _indented_chunk: $ => seq($._indented_chunk_start, repeat(choice($._code_line, $._newline)), $._block_close, optional($._ignore_matching_tokens)),
 
         // A fenced code block. Fenced code blocks are mainly handled by the external scanner. In
         // case of backtick code blocks the external scanner also checks that the info string is
@@ -292,7 +291,7 @@ module.exports = grammar(add_inline_rules({
                 $._block_close,
             ),
         )),
-        code_fence_content: $ => repeat1(choice($._newline, $._text)),
+        code_fence_content: $ => repeat1(choice($._newline, $._code_line)),
         info_string: $ => choice(
             seq($.language, repeat(choice($._text, $.backslash_escape, $.entity_reference, $.numeric_character_reference))),
             repeat1(choice($._text, $.backslash_escape, $.entity_reference, $.numeric_character_reference)),
@@ -302,75 +301,21 @@ module.exports = grammar(add_inline_rules({
         // An HTML block. We do not emit addition nodes relating to the kind or structure or of the
         // html block as this is best done using language injections and a proper html parsers.
         //
-        // See the `build_html_block` function for more information.
-        // See the spec for the different kinds of html blocks.
+        // The kind of html block is decided by the external scanner when it emits the
+        // `$._html_block_start` token for the first line. Blocks of type 1 to 5 are closed by the
+        // external scanner after the line containing their end condition, blocks of type 6 and 7
+        // at the first blank line.
         //
         // https://github.github.com/gfm/#html-blocks
-        html_block: $ => prec(1, seq(optional($._whitespace), choice(
-            $._html_block_1,
-            $._html_block_2,
-            $._html_block_3,
-            $._html_block_4,
-            $._html_block_5,
-            $._html_block_6,
-            $._html_block_7,
-        ))),
-        _html_block_1: $ => build_html_block($,
-            new RegExp(
-                '<' + regex_case_insensitive_list(HTML_TAG_NAMES_RULE_1) + '([\\r\\n]|[ \\t>][^<\\r\\n]*(\\n|\\r\\n?)?)'
-            ),
-            new RegExp('</' + regex_case_insensitive_list(HTML_TAG_NAMES_RULE_1) + '>'),
-            true
-        ),
-        _html_block_2: $ => build_html_block($, '<!--', '-->', true),
-        _html_block_3: $ => build_html_block($, '<?', '?>', true),
-        _html_block_4: $ => build_html_block($, /<![A-Z]+/, '>', true),
-        _html_block_5: $ => build_html_block($, '<![CDATA[', ']]>', true),
-        _html_block_6: $ => choice(
-            build_html_block(
-                $,
-                new RegExp(
-                    '</?' + regex_case_insensitive_list(HTML_TAG_NAMES_RULE_7) + '([ \\t>]|/>)'
-                ),
-                seq($._newline, $._blank_line),
-                true
-            ),
-            build_html_block_after_newline(
-                $,
-                new RegExp('</?' + regex_case_insensitive_list(HTML_TAG_NAMES_RULE_7) + '(\\n|\\r\\n?)'),
-                true
-            ),
-        ),
-        _html_block_7: $ => choice(
-            build_html_block(
-                $,
-                choice($._open_tag_html_block, $._closing_tag_html_block),
-                seq($._newline, $._blank_line),
-                false
-            ),
-            build_html_block_after_newline(
-                $,
-                choice($._open_tag_html_block_newline, $._closing_tag_html_block_newline),
-                false
-            ),
-        ),
-        // HTML tags for opening html blocks are parsed differently as they can only cointain one
-        // token.
-        _open_tag_html_block: $ => new RegExp(
-            '<'
-            + negative_regex(HTML_TAG_NAMES_RULE_1.concat(HTML_TAG_NAMES_RULE_7), '0-9\\-', true)
-            + '([ \\t]+[a-zA-Z_:][a-zA-Z0-9_\\.:\\-]*[ \\t]*=[ \\t]*([^ \\t\\r\\n"\'=<>`]+|\'[^\'\\r\\n]*\'|"[^"\\r\\n]*"))*[ \\t]*/?>[ \\t]'
-        ),
-        _open_tag_html_block_newline: $ => new RegExp(
-            '<'
-            + negative_regex(HTML_TAG_NAMES_RULE_1.concat(HTML_TAG_NAMES_RULE_7), '0-9\\-', true)
-            + '([ \\t]+[a-zA-Z_:][a-zA-Z0-9_\\.:\\-]*[ \\t]*=[ \\t]*([^ \\t\\r\\n"\'=<>`]+|\'[^\'\\r\\n]*\'|"[^"\\r\\n]*"))*[ \\t]*/?>(\n|\r\n?)'
-        ),
-        _closing_tag_html_block: $ => new RegExp(
-            '</' + negative_regex(HTML_TAG_NAMES_RULE_1.concat(HTML_TAG_NAMES_RULE_7), '0-9\\-', true) + '[ \\t]*>[ \\t]'
-        ),
-        _closing_tag_html_block_newline: $ => new RegExp(
-            '</' + negative_regex(HTML_TAG_NAMES_RULE_1.concat(HTML_TAG_NAMES_RULE_7), '0-9\\-', true) + '[ \\t]*>(\n|\r\n?)'
+        html_block: $ => seq(
+            $._html_block_start,
+            repeat(choice(
+                $._html_block_line,
+                $._newline,
+                seq($._newline, $._blank_line, $._close_block),
+            )),
+            $._block_close,
+            optional($._ignore_matching_tokens),
         ),
 
         // A link reference definition. We need to make sure that this is not mistaken for a
@@ -396,33 +341,38 @@ module.exports = grammar(add_inline_rules({
             $._newline,
         )),
 
-        // A paragraph. The parsing tactic for deciding when a paragraph ends is as follows:
-        // on every newline inside a paragraph a conflict is triggered manually using
-        // `$._split_token` to split the parse state into two branches.
-        //
-        // One of them - the one that also contains a `$._soft_line_break_marker` will try to
-        // continue the paragraph, but we make sure that the beginning of a new block that can
-        // interrupt a paragraph can also be parsed. If this is the case we know that the paragraph
-        // should have been closed and the external parser will emit an `$._error` to kill the parse
-        // branch.
-        //
-        // The other parse branch consideres the paragraph to be over. It will be killed if no valid new
-        // block is detected before the next newline. (For example it will also be killed if a indented
-        // code block is detected, which cannot interrupt paragraphs).
-        //
-        // Either way, after the next newline only one branch will exist, so the ammount of branches
-        // related to paragraphs ending does not grow.
+        // A paragraph. Whether a newline inside a paragraph is a soft line break or ends the
+        // paragraph is decided by the external scanner: It looks ahead at the next line and only
+        // emits a `$._soft_line_break_marker` if the line continues the paragraph, either because
+        // all open blocks match or as a lazy continuation line, and does not start a block that can
+        // interrupt a paragraph. Otherwise the tokens for closing or starting blocks follow
+        // directly and end the paragraph.
         //
         // https://github.github.com/gfm/#paragraphs
-        paragraph: $ => seq($._inline, $._paragraph_end_newline),
+        paragraph: $ => seq(
+            choice($._inline, seq(optional($._inline), alias($._degraded_inline, $.degraded_inline))),
+            $._newline,
+        ),
         _soft_line_break: $ => prec.right(seq(
             $._newline,
-            repeat(choice($._split_token, $._soft_line_break_marker)),
             $._soft_line_break_marker,
             optional($._last_token_whitespace),
-            optional($._block_interrupt_paragraph), // not actually valid, we will error if it manages to match a block
         )),
-        _paragraph_end_newline: $ => seq($._newline, repeat($._split_token)),
+
+        // The rest of a paragraph that is too long to parse its inline content in full, as found
+        // in minified or generated documents. The external scanner decides at the first of its
+        // tokens at the top level of the paragraph by looking ahead to its end. After that token
+        // only code spans and backslash escapes are recognized, everything else is kept as long
+        // runs of `$._degraded_text`. The threshold is set when compiling the external scanner, see
+        // `MARKDOWN_DEGRADED_INLINE_THRESHOLD`.
+        _degraded_inline: $ => seq($._degraded_text, repeat($._degraded_inline_element)),
+        _degraded_inline_element: $ => choice(
+            $._degraded_text,
+            $.backslash_escape,
+            alias($._code_span, $.code_span),
+            $._unmatched_code_span_delimiter,
+            $._soft_line_break,
+        ),
 
         // A blank line including the following newline.
         //
@@ -533,12 +483,9 @@ module.exports = grammar(add_inline_rules({
         // https://github.github.com/gfm/#backslash-escapes
         backslash_escape: $ => new RegExp('\\\\[' + PUNCTUATION_CHARACTERS_REGEX + ']'),
 
-        // HTML entity and numeric character references.
-        //
-        // The regex for entity references are build from the html_entities.json file.
+        // Numeric character references. Entity references are parsed by the external scanner.
         //
         // https://github.github.com/gfm/#entity-and-numeric-character-references
-        entity_reference: $ => html_entity_regex(),
         numeric_character_reference: $ => /&#([0-9]{1,7}|[xX][0-9a-fA-F]{1,6});/,
 
         // Different kinds of links:
@@ -547,15 +494,12 @@ module.exports = grammar(add_inline_rules({
         // * collapsed reference links (https://github.github.com/gfm/#collapsed-reference-link)
         // * shortcut links (https://github.github.com/gfm/#shortcut-reference-link)
         //
-        // Dynamic precedence is distributed as granular as possible to help the parser decide
-        // while parsing which branch is the most important.
+        // The external scanner matches the brackets of the link text and tells the kind of link
+        // by the token for the closing bracket, so the parser never has to keep several of them
+        // around. A bracket that does not belong to a link is plain text.
         //
         // https://github.github.com/gfm/#links
-        _link_text: $ => prec.dynamic(PRECEDENCE_LEVEL_LINK, choice(
-            $._link_text_non_empty,
-            seq('[', ']')
-        )),
-        _link_text_non_empty: $ => seq('[', alias($._inline_no_link, $.link_text), ']'),
+        _link_text: $ => seq(alias($._link_open, '['), optional(alias($._inline_no_link, $.link_text))),
         link_label: $ => seq('[', repeat1(choice(
             $._text_inline_no_link,
             $.backslash_escape,
@@ -613,18 +557,21 @@ module.exports = grammar(add_inline_rules({
                 seq($._newline, optional(seq($._blank_line, $._trigger_error)))
             )), ')'),
         ),
-        shortcut_link: $ => prec.dynamic(PRECEDENCE_LEVEL_LINK, $._link_text_non_empty),
-        full_reference_link: $ => prec.dynamic(2 * PRECEDENCE_LEVEL_LINK, seq(
+        shortcut_link: $ => seq($._link_text, alias($._link_close_shortcut, ']')),
+        full_reference_link: $ => seq(
             $._link_text,
+            alias($._link_close_full_reference, ']'),
             $.link_label
-        )),
-        collapsed_reference_link: $ => prec.dynamic(PRECEDENCE_LEVEL_LINK, seq(
+        ),
+        collapsed_reference_link: $ => seq(
             $._link_text,
+            alias($._link_close_collapsed_reference, ']'),
             '[',
             ']'
-        )),
-        inline_link: $ => prec.dynamic(PRECEDENCE_LEVEL_LINK, seq(
+        ),
+        inline_link: $ => seq(
             $._link_text,
+            alias($._link_close_inline, ']'),
             '(',
             repeat(choice($._whitespace, $._soft_line_break)),
             optional(seq(
@@ -641,7 +588,7 @@ module.exports = grammar(add_inline_rules({
                 repeat(choice($._whitespace, $._soft_line_break)),
             )),
             ')'
-        )),
+        ),
 
         // Images work exactly like links with a '!' added in front.
         //
@@ -652,8 +599,9 @@ module.exports = grammar(add_inline_rules({
             $._image_full_reference_link,
             $._image_collapsed_reference_link
         ),
-        _image_inline_link: $ => prec.dynamic(PRECEDENCE_LEVEL_LINK, seq(
+        _image_inline_link: $ => seq(
             $._image_description,
+            alias($._link_close_inline, ']'),
             '(',
             repeat(choice($._whitespace, $._soft_line_break)),
             optional(seq(
@@ -670,12 +618,20 @@ module.exports = grammar(add_inline_rules({
                 repeat(choice($._whitespace, $._soft_line_break)),
             )),
             ')'
-        )),
-        _image_shortcut_link: $ => prec.dynamic(3 * PRECEDENCE_LEVEL_LINK, $._image_description_non_empty),
-        _image_full_reference_link: $ => prec.dynamic(PRECEDENCE_LEVEL_LINK, seq($._image_description, $.link_label)),
-        _image_collapsed_reference_link: $ => prec.dynamic(PRECEDENCE_LEVEL_LINK, seq($._image_description, '[', ']')),
-        _image_description: $ => prec.dynamic(3 * PRECEDENCE_LEVEL_LINK, choice($._image_description_non_empty, seq('!', '[', prec(1, ']')))),
-        _image_description_non_empty: $ => seq('!', '[', alias($._inline, $.image_description), prec(1, ']')),
+        ),
+        _image_shortcut_link: $ => seq($._image_description, alias($._link_close_shortcut, ']')),
+        _image_full_reference_link: $ => seq(
+            $._image_description,
+            alias($._link_close_full_reference, ']'),
+            $.link_label
+        ),
+        _image_collapsed_reference_link: $ => seq(
+            $._image_description,
+            alias($._link_close_collapsed_reference, ']'),
+            '[',
+            ']'
+        ),
+        _image_description: $ => seq(alias($._image_open, '!['), optional(alias($._inline, $.image_description))),
 
         // Autolinks. Uri autolinks actually accept protocolls of arbitrary length which does not
         // align with the spec. This is because the binary for the grammar gets to large if done
@@ -693,82 +649,11 @@ module.exports = grammar(add_inline_rules({
         // by a proper html tree-sitter grammar.
         // 
         // https://github.github.com/gfm/#raw-html
-        html_tag: $ => choice($._open_tag, $._closing_tag, $._html_comment, $._processing_instruction, $._declaration, $._cdata_section),
-        _open_tag: $ => prec.dynamic(PRECEDENCE_LEVEL_HTML, seq('<', $._tag_name, repeat($._attribute), repeat(choice($._whitespace, $._soft_line_break)), optional('/'), '>')),
-        _closing_tag: $ => prec.dynamic(PRECEDENCE_LEVEL_HTML, seq('<', '/', $._tag_name, repeat(choice($._whitespace, $._soft_line_break)), '>')),
-        _tag_name: $ => seq($._word_no_digit, repeat(choice($._word_no_digit, $._digits, '-'))),
-        _attribute: $ => seq(repeat1(choice($._whitespace, $._soft_line_break)), $._attribute_name, repeat(choice($._whitespace, $._soft_line_break)), '=', repeat(choice($._whitespace, $._soft_line_break)), $._attribute_value),
-        _attribute_name: $ => /[a-zA-Z_:][a-zA-Z0-9_\.:\-]*/,
-        _attribute_value: $ => choice(
-            /[^ \t\r\n"'=<>`]+/,
-            seq("'", repeat(choice($._word, $._whitespace, $._soft_line_break, punctuation_without($, ["'"]))), "'"),
-            seq('"', repeat(choice($._word, $._whitespace, $._soft_line_break, punctuation_without($, ['"']))), '"'),
+        html_tag: $ => seq(
+            repeat(seq($._html_tag_line, $._soft_line_break)),
+            $._html_tag_end,
+            optional($._last_token_punctuation),
         ),
-        _html_comment: $ => prec.dynamic(PRECEDENCE_LEVEL_HTML, seq(
-            '<!--',
-            optional(seq(
-                choice(
-                    $._word,
-                    $._whitespace,
-                    $._newline,
-                    punctuation_without($, ['-', '>']),
-                    seq(
-                        '-',
-                        punctuation_without($, ['>']),
-                    )
-                ),
-                repeat(prec.right(choice(
-                    $._word,
-                    $._whitespace,
-                    $._newline,
-                    punctuation_without($, ['-']),
-                    seq(
-                        '-',
-                        choice(
-                            $._word,
-                            $._whitespace,
-                            $._newline,
-                            punctuation_without($, ['-']),
-                        )
-                    )
-                ))),
-            )),
-            '-->'
-        )),
-        _processing_instruction: $ => prec.dynamic(PRECEDENCE_LEVEL_HTML, seq(
-            '<?',
-            repeat(prec.right(choice(
-                $._word,
-                $._whitespace,
-                $._newline,
-                punctuation_without($, []),
-            ))),
-            '?>'
-        )),
-        _declaration: $ => prec.dynamic(PRECEDENCE_LEVEL_HTML, seq(
-            /<![A-Z]+/,
-            choice(
-                $._whitespace,
-                $._newline,
-            ),
-            repeat(prec.right(choice(
-                $._word,
-                $._whitespace,
-                $._newline,
-                punctuation_without($, ['>']),
-            ))),
-            '>'
-        )),
-        _cdata_section: $ => prec.dynamic(PRECEDENCE_LEVEL_HTML, seq(
-            '<![CDATA[',
-            repeat(prec.right(choice(
-                $._word,
-                $._whitespace,
-                $._newline,
-                punctuation_without($, []),
-            ))),
-            ']]>'
-        )),
 
         // A hard line break.
         //
@@ -847,57 +732,31 @@ function add_inline_rules(grammar) {
                     return choice(...elements);
                 };
                 grammar.rules["_inline" + suffix] = $ => repeat1($["_inline_element" + suffix]);
-                conflicts.push(['_code_span' + suffix_newline, '_text_inline' + suffix_delimiter + suffix_link]);
-                if (delimiter !== "star") {
-                    conflicts.push(['_emphasis_star' + suffix_newline + suffix_link, '_text_inline' + suffix_delimiter + suffix_link]);
-                    conflicts.push(['_emphasis_star' + suffix_newline + suffix_link, '_strong_emphasis_star' + suffix_newline + suffix_link, '_text_inline' + suffix_delimiter + suffix_link]);
-                }
                 if (delimiter !== false) {
                     conflicts.push(['_strong_emphasis_' + delimiter + suffix_newline + suffix_link, '_inline_element_no_' + delimiter]);
                 }
-                if (delimiter !== "underscore") {
-                    conflicts.push(['_emphasis_underscore' + suffix_newline + suffix_link, '_text_inline' + suffix_delimiter + suffix_link]);
-                    conflicts.push(['_emphasis_underscore' + suffix_newline + suffix_link, '_strong_emphasis_underscore' + suffix_newline + suffix_link, '_text_inline' + suffix_delimiter + suffix_link]);
-                }
 
                 if (newline) {
-                    conflicts.push(['_html_comment', '_text_inline' + suffix_delimiter + suffix_link]); // TODO: no_newline
-                    conflicts.push(['_cdata_section', '_text_inline' + suffix_delimiter + suffix_link]);
-                    conflicts.push(['_declaration', '_text_inline' + suffix_delimiter + suffix_link]);
-                    conflicts.push(['_processing_instruction', '_text_inline' + suffix_delimiter + suffix_link]);
-                    conflicts.push(['_closing_tag', '_text_inline' + suffix_delimiter + suffix_link]);
-                    conflicts.push(['_open_tag', '_text_inline' + suffix_delimiter + suffix_link]);
-                    conflicts.push(['_link_text_non_empty', 'link_label', '_text_inline' + suffix_delimiter + suffix_link]);
-                    conflicts.push(['_link_text_non_empty', '_text_inline' + suffix_delimiter + suffix_link]);
-                    conflicts.push(['_link_text', '_text_inline' + suffix_delimiter + suffix_link]);
                     conflicts.push(['link_label', '_text_inline' + suffix_delimiter + suffix_link]);
                     conflicts.push(['link_reference_definition', '_text_inline' + suffix_delimiter + suffix_link]);
                     conflicts.push(['hard_line_break', '_text_inline' + suffix_delimiter + suffix_link]);
                     grammar.rules['_text_inline' + suffix_delimiter + suffix_link] = $ => {
                         let elements = [
+                            $._text_run,
                             $._word,
                             punctuation_without($, link ? [] : ['[', ']']),
                             $._whitespace,
-                            $._code_span_start,
-                            '<!--',
-                            /<![A-Z]+/,
-                            '<?',
-                            '<![CDATA[',
+                            $._unmatched_code_span_delimiter,
+                            seq($._unmatched_emphasis_delimiter, optional($._last_token_punctuation)),
                         ];
-                        if (delimiter !== "star") {
-                            elements.push($._emphasis_open_star);
-                        }
-                        if (delimiter !== "underscore") {
-                            elements.push($._emphasis_open_underscore);
-                        }
                         return choice(...elements);
                     }
                 }
             }
             
-            grammar.rules['_emphasis_star' + suffix_newline + suffix_link] = $ => prec.dynamic(PRECEDENCE_LEVEL_EMPHASIS, seq(alias($._emphasis_open_star, $.emphasis_delimiter), optional($._last_token_punctuation), $['_inline' + suffix_newline + '_no_star' + suffix_link], alias($._emphasis_close_star, $.emphasis_delimiter)));
+            grammar.rules['_emphasis_star' + suffix_newline + suffix_link] = $ => prec.dynamic(PRECEDENCE_LEVEL_EMPHASIS, seq(alias($._emphasis_open_star, $.emphasis_delimiter), optional($._last_token_punctuation), $['_inline' + suffix_newline + '_no_star' + suffix_link], alias($._emphasis_close_star, $.emphasis_delimiter), optional($._last_token_punctuation)));
             grammar.rules['_strong_emphasis_star' + suffix_newline + suffix_link] = $ => prec.dynamic(2 * PRECEDENCE_LEVEL_EMPHASIS, seq(alias($._emphasis_open_star, $.emphasis_delimiter), $['_emphasis_star' + suffix_newline + suffix_link], alias($._emphasis_close_star, $.emphasis_delimiter)));
-            grammar.rules['_emphasis_underscore' + suffix_newline + suffix_link] = $ => prec.dynamic(PRECEDENCE_LEVEL_EMPHASIS, seq(alias($._emphasis_open_underscore, $.emphasis_delimiter), optional($._last_token_punctuation), $['_inline' + suffix_newline + '_no_underscore' + suffix_link], alias($._emphasis_close_underscore, $.emphasis_delimiter)));
+            grammar.rules['_emphasis_underscore' + suffix_newline + suffix_link] = $ => prec.dynamic(PRECEDENCE_LEVEL_EMPHASIS, seq(alias($._emphasis_open_underscore, $.emphasis_delimiter), optional($._last_token_punctuation), $['_inline' + suffix_newline + '_no_underscore' + suffix_link], alias($._emphasis_close_underscore, $.emphasis_delimiter), optional($._last_token_punctuation)));
             grammar.rules['_strong_emphasis_underscore' + suffix_newline + suffix_link] = $ => prec.dynamic(2 * PRECEDENCE_LEVEL_EMPHASIS, seq(alias($._emphasis_open_underscore, $.emphasis_delimiter), $['_emphasis_underscore' + suffix_newline + suffix_link], alias($._emphasis_close_underscore, $.emphasis_delimiter)));
         }
         grammar.rules['_code_span' + suffix_newline] = $ => prec.dynamic(PRECEDENCE_LEVEL_CODE_SPAN, seq(alias($._code_span_start, $.code_span_delimiter), repeat(newline ? choice($._text, $._soft_line_break) : $._text), alias($._code_span_close, $.code_span_delimiter)));
@@ -919,67 +778,6 @@ function add_inline_rules(grammar) {
     return grammar;
 }
 
-// Constructs a regex that matches all html entity references.
-function html_entity_regex() {
-    // A file with all html entities, should be kept up to date with
-    // https://html.spec.whatwg.org/multipage/entities.json
-    let html_entities = require("./html_entities.json");
-    let s = '&(';
-    s += Object.keys(html_entities).map(name => name.substring(1, name.length - 1)).join('|');
-    s += ');';
-    return new RegExp(s);
-}
-
-// General purpose structure for html blocks. The different kinds mostly work the same but have
-// different openling and closing conditions. Some html blocks may not interrupt a paragraph and
-// have to be marked as such.
-function build_html_block($, open, close, interrupt_paragraph) {
-    return seq(
-        open,
-        interrupt_paragraph ? $._open_block : $._open_block_dont_interrupt_paragraph,
-        repeat(choice(
-            $._whitespace,
-            $._word,
-            punctuation_without($, []),
-            $._newline,
-            seq(close, $._close_block),
-        )),
-        $._block_close,
-        optional($._ignore_matching_tokens),
-    );
-}
-
-// Mostly the same as `build_html_block`, but for the case that the opening token contains a
-// trailing newline.
-function build_html_block_after_newline($, open, interrupt_paragraph) {
-    return seq(
-        open,
-        interrupt_paragraph ? $._open_block : $._open_block_dont_interrupt_paragraph,
-        $._line_ending,
-        optional($._ignore_matching_tokens),
-        optional(seq($._blank_line, $._close_block)),
-        repeat(choice(
-            $._whitespace,
-            $._word,
-            punctuation_without($, []),
-            $._newline,
-            seq($._newline, $._blank_line, $._close_block),
-        )),
-        $._block_close,
-        optional($._ignore_matching_tokens),
-    );
-}
-
-// Utility function to create a case insensitive regex.
-function regex_case_insensitive_list(ss) {
-    return "(" + ss.map(x => regex_case_insensitive(x)).join("|") + ")";
-}
-
-// Utility function to create a case insensitive regex matching any of a list of strings.
-function regex_case_insensitive(s) {
-    return Array.from(s).map(x => "[" + x + x.toUpperCase() + "]").join("");
-}
-
 // Returns a rule that matches all characters that count as punctuation inside markdown, besides
 // a list of excluded punctuation characters. Calling this function with a empty list as the second
 // argument returns a rule that matches all punctuation.
@@ -987,74 +785,3 @@ function punctuation_without($, chars) {
     return seq(choice(...PUNCTUATION_CHARACTERS_ARRAY.filter(c => !chars.includes(c))), optional($._last_token_punctuation));
 }
 
-// Used to build a regex that matches html tags that do NOT have a tag name from a list of tag
-// names.
-//
-// In particular this returns a regex that matches any string made up of ascii letters and
-// characters specified in `classExtra`, but that is NOT part of the list of strings `ss`.
-function negative_regex(ss, classExtra, isStart) {
-    let chars = {};
-    let end = true;
-    for (let s of ss) {
-        if (s.length > 1) {
-            end = false;
-        }
-        let char = s.charCodeAt(0);
-        if (!(char in chars)) {
-            chars[char] = [];
-        }
-        chars[char].push(s);
-    }
-    let ranges = [['a'.charCodeAt(0), 'z'.charCodeAt(0)]];
-    if (!isStart) {
-        ranges.splice(0, 0, ['0'.charCodeAt(0), '9'.charCodeAt(0)]);
-    }
-    for (let char in chars) {
-        for (let i = 0; i < ranges.length; i++) {
-            let range = ranges[i];
-            if (range[1] < char) continue;
-            if (range[1] != char && range[0] != char) {
-                ranges.splice(i, 1, [range[0], char - 1], [+char + 1, range[1]]);
-            } else if(range[1] == char && range[0] == char) {
-                ranges.splice(i, 1);
-            } else if (range[1] == char) {
-                range[1]--;
-            } else {
-                range[0]++;
-            }
-            break;
-        }
-    }
-    let alphabet = ranges.map(x => {
-        if (x[0] >= 97) { // is letter
-            if (x[0] == x[1]) {
-                return String.fromCharCode(x[0]) + String.fromCharCode(x[0]).toUpperCase();
-            } else {
-                return String.fromCharCode(x[0]) + '-' + String.fromCharCode(x[1]) + String.fromCharCode(x[0]).toUpperCase() + '-' + String.fromCharCode(x[1]).toUpperCase();
-            }
-        } else {
-            if (x[0] == x[1]) {
-                return String.fromCharCode(x[0]);
-            } else {
-                return String.fromCharCode(x[0]) + '-' + String.fromCharCode(x[1]);
-            }
-        }
-    }).join('');
-    let output = '([' + alphabet + (isStart ? '' : classExtra) + '][a-zA-Z' + classExtra + ']*';
-    if (!end) {
-        for (let char in chars) {
-            output += '|' + String.fromCharCode(char);
-            let new_ss = chars[char].map(x => x.substring(1)).filter(x => x.length != 0)
-            if (new_ss.length > 0) {
-                output += '|' + String.fromCharCode(char) + negative_regex(new_ss, classExtra, false);
-            } else {
-                output += '[a-zA-Z' + classExtra + ']+';
-            }
-        }
-    } else {
-        output += '|[' + Object.keys(chars).map(x => String.fromCharCode(x)).join('') + '][a-zA-Z' + classExtra + ']+';
-    }
-    output += ')';
-    return output;
-}
-
@@ -0,0 +1,23 @@
+// A grammar for the inline contents of a single paragraph or heading.
+//
+// This grammar is meant to parse the `inline` nodes produced by the block grammar in `../block`.
+// It inherits all rules from the full markdown grammar in `../grammar.js`, but a document consists
+// only of inline elements. Newlines are always soft line breaks as the block structure is already
+// known.
+
+const markdown = require('../grammar');
+
+module.exports = grammar(markdown, {
+    name: 'markdown_inline',
+
+    rules: {
+        document: $ => seq(
+            optional($._last_token_whitespace),
+            optional($._inline),
+            optional(alias($._degraded_inline, $.degraded_inline)),
+        ),
+
+        _soft_line_break: $ => seq($._newline, optional($._last_token_whitespace)),
+        _newline: $ => /\n|\r\n?/,
+    },
+});
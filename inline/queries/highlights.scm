@@ -0,0 +1,14 @@
+(code_span) @text.literal
+
+(emphasis) @text.emphasis
+
+(strong_emphasis) @text.strong
+
+(link_destination) @text.uri
+
+(link_label) @text.reference
+
+[
+  (backslash_escape)
+  (hard_line_break)
+] @string.escape
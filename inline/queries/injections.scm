@@ -0,0 +1 @@
+((html_tag) @html)
@@ -0,0 +1,5 @@
+// The inline grammar uses the same external tokens as the full markdown grammar, so it also uses
+// the same external scanner. As the inline grammar never asks for a `$._line_ending`, the scanner
+// never tries to match any block structure.
+#define EXTERNAL_SCANNER(function) tree_sitter_markdown_inline_external_scanner_##function
+#include "../../src/scanner.cc"
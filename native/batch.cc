@@ -0,0 +1,244 @@
+#include "batch.h"
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <thread>
+
+namespace markdown {
+
+namespace {
+
+double now() {
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+bool read_file(const std::string &path, std::string &text, std::string &error) {
+    FILE *file = fopen(path.c_str(), "rb");
+    if (!file) {
+        error = strerror(errno);
+        return false;
+    }
+    text.clear();
+    char buffer[64 * 1024];
+    size_t size;
+    while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0) text.append(buffer, size);
+    bool failed = ferror(file);
+    if (failed) error = strerror(errno);
+    fclose(file);
+    return !failed;
+}
+
+// The documents a worker has yet to parse, by index into the input list. The owner takes them
+// from the front, other workers steal from the back, so owner and thieves rarely want the same
+// document.
+struct WorkQueue {
+    std::mutex mutex;
+    std::deque<size_t> jobs;
+};
+
+class Batch {
+  public:
+    Batch(const std::vector<BatchInput> &inputs, Sink &sink, const BatchOptions &options)
+        : inputs(inputs), sink(sink), options(options), queues(thread_count(options)),
+          failures(0), bytes(0), steals(0) {
+        // Contiguous ranges, so every worker starts out on neighbouring documents
+        size_t count = queues.size();
+        for (size_t worker = 0; worker < count; worker++) {
+            size_t start = inputs.size() * worker / count;
+            size_t end = inputs.size() * (worker + 1) / count;
+            for (size_t i = start; i < end; i++) queues[worker].jobs.push_back(i);
+        }
+    }
+
+    BatchStats run() {
+        double start = now();
+        std::vector<std::thread> threads;
+        for (unsigned worker = 1; worker < queues.size(); worker++) {
+            threads.emplace_back(&Batch::work, this, worker);
+        }
+        work(0);
+        for (std::thread &thread : threads) thread.join();
+
+        BatchStats stats;
+        stats.documents = inputs.size();
+        stats.failures = failures;
+        stats.bytes = bytes;
+        stats.seconds = now() - start;
+        stats.steals = steals;
+        return stats;
+    }
+
+  private:
+    const std::vector<BatchInput> &inputs;
+    Sink &sink;
+    const BatchOptions &options;
+    std::vector<WorkQueue> queues;
+    std::atomic<size_t> failures;
+    std::atomic<size_t> bytes;
+    std::atomic<size_t> steals;
+
+    static size_t thread_count(const BatchOptions &options) {
+        unsigned threads = options.threads;
+        if (threads == 0) threads = std::thread::hardware_concurrency();
+        return threads == 0 ? 1 : threads;
+    }
+
+    // Take the next document off the worker's own queue or steal one from another worker. No
+    // documents are added once the workers run, so all queues being empty means the batch is done.
+    bool next(unsigned worker, size_t &index) {
+        {
+            WorkQueue &queue = queues[worker];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.jobs.empty()) {
+                index = queue.jobs.front();
+                queue.jobs.pop_front();
+                return true;
+            }
+        }
+        for (size_t i = 1; i < queues.size(); i++) {
+            WorkQueue &queue = queues[(worker + i) % queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.jobs.empty()) {
+                index = queue.jobs.back();
+                queue.jobs.pop_back();
+                steals++;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void work(unsigned worker) {
+        TSParser *parser = ts_parser_new();
+        ts_parser_set_language(parser, options.language ? options.language : tree_sitter_markdown());
+        ts_parser_set_timeout_micros(parser, options.timeout_micros);
+        // Reused for every file the worker reads
+        std::string text;
+        size_t index;
+        while (next(worker, index)) {
+            const BatchInput &input = inputs[index];
+            BatchResult result;
+            result.index = index;
+            result.input = &input;
+            result.tree = NULL;
+            result.seconds = 0;
+            result.worker = worker;
+            bool loaded = true;
+            if (input.data) {
+                result.text = input.data;
+                result.size = input.size;
+            } else {
+                loaded = read_file(input.path, text, result.error);
+                result.text = text.data();
+                result.size = loaded ? text.size() : 0;
+            }
+
+            TSTree *tree = NULL;
+            if (loaded) {
+                double start = now();
+                tree = ts_parser_parse_string(parser, NULL, result.text, result.size);
+                result.seconds = now() - start;
+                if (!tree) {
+                    // Otherwise the next parse would resume this one
+                    ts_parser_reset(parser);
+                    result.error = "timed out";
+                }
+            }
+            result.tree = tree;
+            if (!tree) failures++;
+            bytes += result.size;
+            sink.consume(result);
+            ts_tree_delete(tree);
+        }
+        ts_parser_delete(parser);
+    }
+};
+
+}  // namespace
+
+BatchInput BatchInput::file(const std::string &path) {
+    BatchInput input = {path, path, NULL, 0};
+    return input;
+}
+
+BatchInput BatchInput::buffer(const std::string &name, const char *data, size_t size) {
+    BatchInput input = {name, "", data, size};
+    return input;
+}
+
+void StreamSink::consume(const BatchResult &result) {
+    std::string record = format(result);
+    std::lock_guard<std::mutex> lock(mutex);
+    fwrite(record.data(), 1, record.size(), output);
+}
+
+static std::string error_record(const BatchResult &result) {
+    return result.input->name + "\terror\t" + result.error + "\n";
+}
+
+std::string ErrorCountSink::format(const BatchResult &result) {
+    if (!result.tree) return error_record(result);
+    size_t nodes;
+    size_t errors;
+    count_nodes(result.tree, &nodes, &errors);
+    return result.input->name + "\t" + std::to_string(result.size) + "\t" + std::to_string(nodes) +
+        "\t" + std::to_string(errors) + "\n";
+}
+
+std::string SpanSink::format(const BatchResult &result) {
+    if (!result.tree) return error_record(result);
+    std::string record;
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(result.tree));
+    for (;;) {
+        TSNode node = ts_tree_cursor_current_node(&cursor);
+        if (ts_node_is_named(node)) {
+            record += result.input->name;
+            record += '\t';
+            record += ts_node_type(node);
+            record += '\t';
+            record += std::to_string(ts_node_start_byte(node));
+            record += '\t';
+            record += std::to_string(ts_node_end_byte(node));
+            record += '\n';
+        }
+        if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                ts_tree_cursor_delete(&cursor);
+                return record;
+            }
+        }
+    }
+}
+
+BatchStats parse_batch(
+    const std::vector<BatchInput> &inputs,
+    Sink &sink,
+    const BatchOptions &options
+) {
+    Batch batch(inputs, sink, options);
+    return batch.run();
+}
+
+void count_nodes(const TSTree *tree, size_t *nodes, size_t *errors) {
+    *nodes = 0;
+    *errors = 0;
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+    for (;;) {
+        TSNode node = ts_tree_cursor_current_node(&cursor);
+        (*nodes)++;
+        if (ts_node_is_missing(node) || strcmp(ts_node_type(node), "ERROR") == 0) (*errors)++;
+        if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                ts_tree_cursor_delete(&cursor);
+                return;
+            }
+        }
+    }
+}
+
+}  // namespace markdown
@@ -0,0 +1,132 @@
+// Parallel batch parsing of many documents.
+//
+// `parse_batch` parses a list of files or in-memory buffers on a pool of worker threads. Every
+// worker owns one `TSParser` for the whole batch, all of them using the same language, and takes
+// documents from its own queue, stealing from the other workers' queues when it runs out. The
+// external scanner keeps all of its state in the scanner object of its parser, so workers never
+// contend on anything but their queues and the sink. The only exception are the counters of a
+// scanner built with `MARKDOWN_SCANNER_STATS`, which all parsers share.
+//
+// Results are streamed to a `Sink` as soon as a document is parsed, in the order the documents
+// finish. See the comment at the top of `batch_main.cc` for how to build the library and the
+// command line tool around it.
+
+#ifndef TREE_SITTER_MARKDOWN_BATCH_H_
+#define TREE_SITTER_MARKDOWN_BATCH_H_
+
+#include <tree_sitter/api.h>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+extern "C" const TSLanguage *tree_sitter_markdown();
+extern "C" const TSLanguage *tree_sitter_markdown_block();
+
+namespace markdown {
+
+// A document to parse: the file at `path`, or the `size` bytes at `data` if `data` is set. The
+// buffer has to stay alive until `parse_batch` returns. `name` identifies the document in the
+// output and defaults to the path.
+struct BatchInput {
+    std::string name;
+    std::string path;
+    const char *data;
+    size_t size;
+
+    static BatchInput file(const std::string &path);
+    static BatchInput buffer(const std::string &name, const char *data, size_t size);
+};
+
+struct BatchOptions {
+    // Number of worker threads, 0 for one per hardware thread
+    unsigned threads;
+    // The grammar to parse with, `tree_sitter_markdown()` if NULL
+    const TSLanguage *language;
+    // Timeout for every single document in microseconds, 0 for none
+    uint64_t timeout_micros;
+};
+
+// What a worker hands to the sink for every document.
+struct BatchResult {
+    // Position of the document in the input list
+    size_t index;
+    const BatchInput *input;
+    // The contents of the document
+    const char *text;
+    size_t size;
+    // NULL if the document could not be read or parsing timed out, see `error`. The tree is deleted
+    // after the sink returns.
+    const TSTree *tree;
+    std::string error;
+    // Time spent parsing, without reading the file
+    double seconds;
+    unsigned worker;
+};
+
+// Receives the results of a batch. `consume` is called on the worker threads, concurrently for
+// different documents, and has to be thread safe.
+class Sink {
+  public:
+    virtual ~Sink() {}
+    virtual void consume(const BatchResult &result) = 0;
+};
+
+// A sink that writes one record per document to a stream. Records are formatted concurrently on
+// the workers and written whole under a lock, so records of different documents never interleave.
+class StreamSink : public Sink {
+  public:
+    explicit StreamSink(FILE *output) : output(output) {}
+    void consume(const BatchResult &result) override;
+
+  protected:
+    virtual std::string format(const BatchResult &result) = 0;
+
+  private:
+    FILE *output;
+    std::mutex mutex;
+};
+
+// Writes `name<TAB>bytes<TAB>nodes<TAB>errors` per document, where `errors` counts the `ERROR`
+// and missing nodes, or `name<TAB>error<TAB>message` if the document failed.
+class ErrorCountSink : public StreamSink {
+  public:
+    explicit ErrorCountSink(FILE *output) : StreamSink(output) {}
+
+  protected:
+    std::string format(const BatchResult &result) override;
+};
+
+// Writes `name<TAB>type<TAB>start byte<TAB>end byte` for every named node in document order, or
+// one error line like `ErrorCountSink` if the document failed.
+class SpanSink : public StreamSink {
+  public:
+    explicit SpanSink(FILE *output) : StreamSink(output) {}
+
+  protected:
+    std::string format(const BatchResult &result) override;
+};
+
+struct BatchStats {
+    size_t documents;
+    size_t failures;
+    size_t bytes;
+    // Wall clock time of the whole batch
+    double seconds;
+    // Documents that workers took from the queue of another worker
+    size_t steals;
+};
+
+BatchStats parse_batch(
+    const std::vector<BatchInput> &inputs,
+    Sink &sink,
+    const BatchOptions &options = BatchOptions()
+);
+
+// The number of nodes of a tree and how many of them are `ERROR` or missing nodes.
+void count_nodes(const TSTree *tree, size_t *nodes, size_t *errors);
+
+}  // namespace markdown
+
+#endif  // TREE_SITTER_MARKDOWN_BATCH_H_
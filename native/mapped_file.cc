@@ -0,0 +1,202 @@
+#include "mapped_file.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace markdown {
+
+namespace {
+
+// Block size for comparing the previous and the current contents
+const size_t COMPARE_BLOCK_SIZE = 64 * 1024;
+
+struct Mapping {
+    const char *text;
+    size_t size;
+    dev_t device;
+    ino_t inode;
+};
+
+bool map_file(const std::string &path, Mapping &mapping, std::string &error) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        error = path + ": " + strerror(errno);
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        error = path + ": " + strerror(errno);
+        close(fd);
+        return false;
+    }
+    if ((uint64_t)info.st_size > UINT32_MAX) {
+        error = path + ": too large to parse";
+        close(fd);
+        return false;
+    }
+    mapping.text = "";
+    mapping.size = info.st_size;
+    mapping.device = info.st_dev;
+    mapping.inode = info.st_ino;
+    // Mapping zero bytes fails
+    if (mapping.size > 0) {
+        void *address = mmap(NULL, mapping.size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address == MAP_FAILED) {
+            error = path + ": " + strerror(errno);
+            close(fd);
+            return false;
+        }
+        madvise(address, mapping.size, MADV_SEQUENTIAL);
+        mapping.text = static_cast<const char *>(address);
+    }
+    // The mapping keeps the file open
+    close(fd);
+    return true;
+}
+
+void unmap(const char *text, size_t size) {
+    if (size > 0) munmap(const_cast<char *>(text), size);
+}
+
+// Ask the kernel to read the pages of [start, end) ahead, as the parser is going to read them
+void will_need(const char *text, size_t start, size_t end) {
+    if (start >= end) return;
+    size_t page = sysconf(_SC_PAGESIZE);
+    size_t first = start / page * page;
+    madvise(const_cast<char *>(text + first), end - first, MADV_WILLNEED);
+}
+
+// The point after `length` bytes of `text` starting at `point`
+TSPoint advance(TSPoint point, const char *text, size_t length) {
+    const char *end = text + length;
+    const char *line = text;
+    for (;;) {
+        const char *newline = static_cast<const char *>(memchr(line, '\n', end - line));
+        if (!newline) break;
+        point.row++;
+        point.column = 0;
+        line = newline + 1;
+    }
+    point.column += end - line;
+    return point;
+}
+
+size_t common_prefix(const char *a, const char *b, size_t length) {
+    size_t i = 0;
+    while (i + COMPARE_BLOCK_SIZE <= length && memcmp(a + i, b + i, COMPARE_BLOCK_SIZE) == 0) {
+        i += COMPARE_BLOCK_SIZE;
+    }
+    while (i < length && a[i] == b[i]) i++;
+    return i;
+}
+
+// Length of the common suffix of a[0..a_length) and b[0..b_length), at most `limit`
+size_t common_suffix(const char *a, size_t a_length, const char *b, size_t b_length, size_t limit) {
+    size_t i = 0;
+    while (
+        i + COMPARE_BLOCK_SIZE <= limit &&
+        memcmp(
+            a + a_length - i - COMPARE_BLOCK_SIZE,
+            b + b_length - i - COMPARE_BLOCK_SIZE,
+            COMPARE_BLOCK_SIZE
+        ) == 0
+    ) {
+        i += COMPARE_BLOCK_SIZE;
+    }
+    while (i < limit && a[a_length - i - 1] == b[b_length - i - 1]) i++;
+    return i;
+}
+
+const char *read_mapping(void *payload, uint32_t byte_index, TSPoint, uint32_t *bytes_read) {
+    const MappedFile *file = static_cast<const MappedFile *>(payload);
+    if (byte_index >= file->size) {
+        *bytes_read = 0;
+        return "";
+    }
+    *bytes_read = file->size - byte_index;
+    return file->text + byte_index;
+}
+
+}  // namespace
+
+MappedFile::MappedFile(const std::string &path)
+    : text(""), size(0), path(path), device(0), inode(0) {}
+
+MappedFile::~MappedFile() {
+    unmap(text, size);
+}
+
+std::unique_ptr<MappedFile> MappedFile::open(const std::string &path, std::string &error) {
+    Mapping mapping;
+    if (!map_file(path, mapping, error)) return NULL;
+    std::unique_ptr<MappedFile> file(new MappedFile(path));
+    file->text = mapping.text;
+    file->size = mapping.size;
+    file->device = mapping.device;
+    file->inode = mapping.inode;
+    return file;
+}
+
+TSInput MappedFile::input() const {
+    TSInput input;
+    input.payload = const_cast<MappedFile *>(this);
+    input.read = read_mapping;
+    input.encoding = TSInputEncodingUTF8;
+    return input;
+}
+
+bool MappedFile::reload(TSTree *tree, std::string &error, TSInputEdit *applied) {
+    Mapping mapping;
+    if (!map_file(path, mapping, error)) return false;
+
+    TSInputEdit edit;
+    if (mapping.device == device && mapping.inode == inode) {
+        // Rewritten in place, the previous mapping already shows (some of) the new contents
+        edit.start_byte = 0;
+        edit.old_end_byte = size;
+        edit.new_end_byte = mapping.size;
+        edit.start_point = {0, 0};
+        edit.old_end_point = tree ? ts_node_end_point(ts_tree_root_node(tree))
+                                  : TSPoint{UINT32_MAX, UINT32_MAX};
+    } else {
+        size_t start = common_prefix(text, mapping.text, std::min(size, mapping.size));
+        size_t suffix = common_suffix(
+            text,
+            size,
+            mapping.text,
+            mapping.size,
+            std::min(size, mapping.size) - start
+        );
+        edit.start_byte = start;
+        edit.old_end_byte = size - suffix;
+        edit.new_end_byte = mapping.size - suffix;
+        edit.start_point = advance({0, 0}, text, start);
+        edit.old_end_point = advance(edit.start_point, text + start, edit.old_end_byte - start);
+    }
+    edit.new_end_point = advance(
+        edit.start_point,
+        mapping.text + edit.start_byte,
+        edit.new_end_byte - edit.start_byte
+    );
+    if (tree) ts_tree_edit(tree, &edit);
+    if (applied) *applied = edit;
+
+    unmap(text, size);
+    text = mapping.text;
+    size = mapping.size;
+    device = mapping.device;
+    inode = mapping.inode;
+    // The parser reads the edited range and skips most of the rest, reusing the old tree
+    will_need(text, edit.start_byte, edit.new_end_byte);
+    return true;
+}
+
+TSTree *parse_mapped(TSParser *parser, const TSTree *old_tree, const MappedFile &file) {
+    return ts_parser_parse(parser, old_tree, file.input());
+}
+
+}  // namespace markdown
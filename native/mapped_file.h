@@ -0,0 +1,67 @@
+// Zero-copy parsing of memory-mapped files.
+//
+// `MappedFile` maps a file read-only and hands the parser pointers straight into the mapping
+// through a `TSInput`, so the document is never copied into a buffer of its own. The kernel is
+// advised that the mapping is read sequentially, which is how tree-sitter reads its input, so it
+// reads ahead aggressively and can drop pages behind the parser under memory pressure.
+//
+// For a file that is rewritten while its tree is kept, `reload` maps the new contents and
+// applies the change to the tree as a single `TSInputEdit`, after which the tree can be reparsed
+// incrementally. Only the edited range is advised as needed again. This relies on the
+// writer replacing the file, for example by renaming a new file over it, as editors and
+// generators usually do. A file that is truncated in place while it is mapped makes accessing the
+// mapping fail with SIGBUS, like with any other mapping.
+//
+// See the comment at the top of `mapped_main.cc` for how to build it.
+
+#ifndef TREE_SITTER_MARKDOWN_MAPPED_FILE_H_
+#define TREE_SITTER_MARKDOWN_MAPPED_FILE_H_
+
+#include <tree_sitter/api.h>
+#include <sys/types.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace markdown {
+
+class MappedFile {
+  public:
+    // Map the file at `path`. Returns NULL and sets `error` if it cannot be opened or mapped or is
+    // larger than the 4 GB tree-sitter can address.
+    static std::unique_ptr<MappedFile> open(const std::string &path, std::string &error);
+
+    ~MappedFile();
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    // The contents of the file at the time it was last mapped
+    const char *text;
+    size_t size;
+
+    // An input that reads from the mapping. It is valid until the file is reloaded or destroyed.
+    TSInput input() const;
+
+    // Map the current contents of the file again and edit `tree`, a tree of the previous contents,
+    // with the range in which they differ, so that `parse_mapped` can update it incrementally. The
+    // edit is also stored in `applied` if given, for other trees of the same file. If the file was
+    // rewritten in place instead of replaced, the previous contents are gone and the edit covers
+    // the whole file. Returns false and sets `error` if the file cannot be mapped, the previous
+    // contents stay mapped in that case.
+    bool reload(TSTree *tree, std::string &error, TSInputEdit *applied = NULL);
+
+  private:
+    std::string path;
+    // Identity of the mapped file, to tell a replaced file from one rewritten in place
+    dev_t device;
+    ino_t inode;
+
+    explicit MappedFile(const std::string &path);
+};
+
+// Parse a mapped file, incrementally if `old_tree` is given and was edited to match the file.
+TSTree *parse_mapped(TSParser *parser, const TSTree *old_tree, const MappedFile &file);
+
+}  // namespace markdown
+
+#endif  // TREE_SITTER_MARKDOWN_MAPPED_FILE_H_
@@ -0,0 +1,143 @@
+// Command line tool for parsing memory-mapped files, see `mapped_file.h`.
+//
+// Parses a file through its mapping and reports the parse time and the peak resident set size of
+// the process. With `--copy` the file is read into a string and parsed from there instead, as most
+// callers do, to compare the memory usage. With `--follow` the tool keeps the tree and waits for
+// a line on standard input every time the file changed, then reloads the file and reparses it
+// incrementally.
+//
+// Build (after `tree-sitter generate` in the root and `block` directories, against an installed
+// tree-sitter runtime):
+//
+//     cc -O2 -std=c99 -Isrc -c src/parser.c -o parser.o
+//     cc -O2 -std=c99 -Iblock/src -c block/src/parser.c -o block_parser.o
+//     SOURCES="native/mapped_main.cc native/mapped_file.cc src/scanner.cc block/src/scanner.cc"
+//     c++ -O2 -std=c++11 -Isrc $SOURCES parser.o block_parser.o -ltree-sitter -o markdown-mapped
+//
+// Usage:
+//
+//     ./markdown-mapped [--block] [--copy | --follow] <file>
+//
+// Peak RSS is a process wide high water mark, so compare separate runs with and without `--copy`.
+
+#include "mapped_file.h"
+#include <sys/resource.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+extern "C" const TSLanguage *tree_sitter_markdown();
+extern "C" const TSLanguage *tree_sitter_markdown_block();
+
+static double now() {
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+static long peak_rss_kb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+}
+
+static void report(const char *what, size_t bytes, double seconds) {
+    printf(
+        "%s: %zu bytes in %.3f s (%.2f MB/s), peak RSS %ld KB\n",
+        what,
+        bytes,
+        seconds,
+        bytes / (1024.0 * 1024.0) / seconds,
+        peak_rss_kb()
+    );
+}
+
+int main(int argc, char **argv) {
+    const TSLanguage *language = tree_sitter_markdown();
+    bool copy = false;
+    bool follow = false;
+    const char *path = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--block") == 0) {
+            language = tree_sitter_markdown_block();
+        } else if (strcmp(argv[i], "--copy") == 0) {
+            copy = true;
+        } else if (strcmp(argv[i], "--follow") == 0) {
+            follow = true;
+        } else {
+            path = argv[i];
+        }
+    }
+    if (!path || (copy && follow)) {
+        fprintf(stderr, "usage: %s [--block] [--copy | --follow] <file>\n", argv[0]);
+        return 1;
+    }
+
+    TSParser *parser = ts_parser_new();
+    ts_parser_set_language(parser, language);
+
+    if (copy) {
+        // Read the file with a single read into a string of its size, so there is only one copy
+        std::ifstream stream(path, std::ios::binary | std::ios::ate);
+        std::string text;
+        if (stream) {
+            text.resize(static_cast<size_t>(stream.tellg()));
+            stream.seekg(0);
+            stream.read(&text[0], text.size());
+        }
+        if (!stream) {
+            fprintf(stderr, "could not read %s\n", path);
+            ts_parser_delete(parser);
+            return 1;
+        }
+        double start = now();
+        TSTree *tree = ts_parser_parse_string(parser, NULL, text.data(), text.size());
+        report("copied", text.size(), now() - start);
+        ts_tree_delete(tree);
+        ts_parser_delete(parser);
+        return 0;
+    }
+
+    std::string error;
+    std::unique_ptr<markdown::MappedFile> file = markdown::MappedFile::open(path, error);
+    if (!file) {
+        fprintf(stderr, "%s\n", error.c_str());
+        ts_parser_delete(parser);
+        return 1;
+    }
+    double start = now();
+    TSTree *tree = markdown::parse_mapped(parser, NULL, *file);
+    report("mapped", file->size, now() - start);
+
+    std::string line;
+    while (follow && std::getline(std::cin, line)) {
+        TSInputEdit edit;
+        if (!file->reload(tree, error, &edit)) {
+            fprintf(stderr, "%s\n", error.c_str());
+            continue;
+        }
+        start = now();
+        TSTree *new_tree = markdown::parse_mapped(parser, tree, *file);
+        double seconds = now() - start;
+        ts_tree_delete(tree);
+        tree = new_tree;
+        printf(
+            "edit at %u: %u bytes replaced with %u bytes, reparsed in %.3f s\n",
+            edit.start_byte,
+            edit.old_end_byte - edit.start_byte,
+            edit.new_end_byte - edit.start_byte,
+            seconds
+        );
+        fflush(stdout);
+    }
+
+    ts_tree_delete(tree);
+    ts_parser_delete(parser);
+    return 0;
+}
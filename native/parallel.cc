@@ -0,0 +1,269 @@
+#include "parallel.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+namespace markdown {
+
+namespace {
+
+const size_t DEFAULT_CHUNK_SIZE = 256 * 1024;
+const size_t CHUNKS_PER_THREAD = 4;
+// Maximum length of a node in the description of a mismatch
+const size_t MISMATCH_LENGTH = 200;
+
+double now() {
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+// The start of the line after the one containing `byte`
+size_t line_end(const char *text, size_t size, size_t byte) {
+    const char *newline = static_cast<const char *>(memchr(text + byte, '\n', size - byte));
+    return newline ? newline - text + 1 : size;
+}
+
+bool is_blank(const char *text, size_t start, size_t end) {
+    for (size_t i = start; i < end; i++) {
+        if (text[i] != ' ' && text[i] != '\t' && text[i] != '\r' && text[i] != '\n') return false;
+    }
+    return true;
+}
+
+// Whether a line starting with `c` can start a top level block after a blank line. Indented lines
+// continue list items or start indented code, `>` starts a block quote and `-`, `+`, `*` and digits
+// may start a list item that continues the list before the blank line.
+bool may_start_chunk(char c) {
+    const char excluded[] = " \t\r\n>-+*0123456789";
+    return !memchr(excluded, c, sizeof(excluded) - 1);
+}
+
+// The first candidate for a safe point in [from, limit), or `limit` if there is none
+size_t find_candidate(const char *text, size_t size, size_t from, size_t limit) {
+    size_t start = from == 0 ? 0 : line_end(text, size, from - 1);
+    bool previous_blank = false;
+    if (start > 0) {
+        size_t previous = start - 1;
+        while (previous > 0 && text[previous - 1] != '\n') previous--;
+        previous_blank = is_blank(text, previous, start);
+    }
+    while (start < limit && start < size) {
+        if (previous_blank && may_start_chunk(text[start])) return start;
+        size_t end = line_end(text, size, start);
+        previous_blank = is_blank(text, start, end);
+        start = end;
+    }
+    return limit;
+}
+
+// The point after `count` bytes starting at the beginning of a line at `point`
+TSPoint advance_point(const char *text, TSPoint point, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (text[i] == '\n') {
+            point.row++;
+            point.column = 0;
+        } else {
+            point.column++;
+        }
+    }
+    return point;
+}
+
+// The range a chunk is parsed with: up to the end of the first line of the next chunk
+TSRange chunk_range(const char *text, size_t size, const ParallelChunk &chunk) {
+    TSRange range;
+    range.start_byte = chunk.start_byte;
+    range.start_point = chunk.start_point;
+    if (chunk.end_byte == size) {
+        range.end_byte = UINT32_MAX;
+        range.end_point = {UINT32_MAX, UINT32_MAX};
+    } else {
+        size_t end = line_end(text, size, chunk.end_byte);
+        range.end_byte = end;
+        range.end_point = advance_point(text + chunk.end_byte, chunk.end_point, end - chunk.end_byte);
+    }
+    return range;
+}
+
+// Whether the end of a chunk is a safe point: its tree has a top level block starting there and
+// all blocks before it end there at the latest.
+bool ends_at_safe_point(const ParallelChunk &chunk) {
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(chunk.tree));
+    bool result = false;
+    if (ts_tree_cursor_goto_first_child(&cursor)) {
+        do {
+            TSNode child = ts_tree_cursor_current_node(&cursor);
+            if (ts_node_start_byte(child) >= chunk.end_byte) {
+                result = ts_node_start_byte(child) == chunk.end_byte;
+                break;
+            }
+            if (ts_node_end_byte(child) > chunk.end_byte) break;
+        } while (ts_tree_cursor_goto_next_sibling(&cursor));
+    }
+    ts_tree_cursor_delete(&cursor);
+    return result;
+}
+
+// (Re)parse the chunks at the indices in `jobs`, taking them one at a time on `threads` threads
+void parse_chunks(
+    const char *text,
+    size_t size,
+    std::vector<ParallelChunk> &chunks,
+    const std::vector<size_t> &jobs,
+    const TSLanguage *language,
+    unsigned threads
+) {
+    std::atomic<size_t> next(0);
+    auto work = [&]() {
+        TSParser *parser = ts_parser_new();
+        ts_parser_set_language(parser, language);
+        for (size_t job = next++; job < jobs.size(); job = next++) {
+            ParallelChunk &chunk = chunks[jobs[job]];
+            TSRange range = chunk_range(text, size, chunk);
+            ts_parser_set_included_ranges(parser, &range, 1);
+            ts_tree_delete(chunk.tree);
+            chunk.tree = ts_parser_parse_string(parser, NULL, text, size);
+        }
+        ts_parser_delete(parser);
+    };
+    std::vector<std::thread> workers;
+    for (unsigned i = 1; i < std::min<size_t>(threads, jobs.size()); i++) workers.emplace_back(work);
+    work();
+    for (std::thread &worker : workers) worker.join();
+}
+
+std::string describe(TSNode node) {
+    char *sexp = ts_node_string(node);
+    std::string result = sexp;
+    free(sexp);
+    if (result.size() > MISMATCH_LENGTH) result = result.substr(0, MISMATCH_LENGTH) + "...";
+    return result + " at " + std::to_string(ts_node_start_byte(node)) + "-" +
+        std::to_string(ts_node_end_byte(node));
+}
+
+// Compare the top level blocks of a sequential parse with those of the parallel parse
+std::string compare(TSTree *tree, const std::vector<TSNode> &blocks) {
+    std::vector<TSNode> expected;
+    TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+    if (ts_tree_cursor_goto_first_child(&cursor)) {
+        do {
+            expected.push_back(ts_tree_cursor_current_node(&cursor));
+        } while (ts_tree_cursor_goto_next_sibling(&cursor));
+    }
+    ts_tree_cursor_delete(&cursor);
+
+    for (size_t i = 0; i < std::min(expected.size(), blocks.size()); i++) {
+        std::string a = describe(expected[i]);
+        std::string b = describe(blocks[i]);
+        if (a != b) {
+            return "block " + std::to_string(i) + " differs\n  sequential: " + a + "\n  parallel: " + b;
+        }
+    }
+    if (expected.size() != blocks.size()) {
+        return std::to_string(expected.size()) + " top level blocks in the sequential parse, " +
+            std::to_string(blocks.size()) + " in the parallel parse";
+    }
+    return "";
+}
+
+}  // namespace
+
+ParallelDocument::ParallelDocument()
+    : rejected_candidates(0), seconds(0), verified(false), sequential_seconds(0) {}
+
+ParallelDocument::~ParallelDocument() {
+    for (ParallelChunk &chunk : chunks) ts_tree_delete(chunk.tree);
+}
+
+std::vector<TSNode> ParallelDocument::blocks() const {
+    std::vector<TSNode> result;
+    for (const ParallelChunk &chunk : chunks) {
+        bool last = &chunk == &chunks.back();
+        TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(chunk.tree));
+        if (ts_tree_cursor_goto_first_child(&cursor)) {
+            do {
+                TSNode child = ts_tree_cursor_current_node(&cursor);
+                if (!last && ts_node_start_byte(child) >= chunk.end_byte) break;
+                result.push_back(child);
+            } while (ts_tree_cursor_goto_next_sibling(&cursor));
+        }
+        ts_tree_cursor_delete(&cursor);
+    }
+    return result;
+}
+
+std::unique_ptr<ParallelDocument> parse_parallel(
+    const char *text,
+    size_t size,
+    const ParallelOptions &options
+) {
+    unsigned threads = options.threads ? options.threads : std::thread::hardware_concurrency();
+    if (threads == 0) threads = 1;
+    const TSLanguage *language = options.language ? options.language : tree_sitter_markdown();
+    size_t chunk_size = options.chunk_size ? options.chunk_size : DEFAULT_CHUNK_SIZE;
+    size_t count = std::max<size_t>(1, std::min(size / chunk_size, threads * CHUNKS_PER_THREAD));
+
+    std::unique_ptr<ParallelDocument> document(new ParallelDocument());
+    double start = now();
+
+    // Split at the first candidate after every multiple of size / count
+    std::vector<ParallelChunk> &chunks = document->chunks;
+    ParallelChunk chunk = {0, 0, {0, 0}, {0, 0}, NULL};
+    for (size_t i = 1; i <= count; i++) {
+        size_t limit = i == count ? size : size * (i + 1) / count;
+        size_t boundary = i == count ? size : find_candidate(text, size, size * i / count, limit);
+        if (i < count && (boundary <= chunk.start_byte || boundary == limit)) continue;
+        chunk.end_byte = boundary;
+        chunk.end_point = advance_point(
+            text + chunk.start_byte,
+            chunk.start_point,
+            boundary - chunk.start_byte
+        );
+        chunks.push_back(chunk);
+        chunk.start_byte = boundary;
+        chunk.start_point = chunk.end_point;
+    }
+
+    std::vector<size_t> jobs;
+    for (size_t i = 0; i < chunks.size(); i++) jobs.push_back(i);
+    while (!jobs.empty()) {
+        parse_chunks(text, size, chunks, jobs, language, threads);
+        // Merge the chunks on both sides of every candidate that is not a safe point. The tree of
+        // the chunk after such a candidate is meaningless, so the next candidate is only checked
+        // once the merged chunk has been parsed again.
+        std::vector<ParallelChunk> merged;
+        jobs.clear();
+        for (ParallelChunk &next : chunks) {
+            bool stale = !jobs.empty() && jobs.back() == merged.size() - 1;
+            if (merged.empty() || stale || ends_at_safe_point(merged.back())) {
+                merged.push_back(next);
+                continue;
+            }
+            merged.back().end_byte = next.end_byte;
+            merged.back().end_point = next.end_point;
+            ts_tree_delete(next.tree);
+            jobs.push_back(merged.size() - 1);
+            document->rejected_candidates++;
+        }
+        chunks.swap(merged);
+    }
+    document->seconds = now() - start;
+
+    if (options.verify) {
+        TSParser *parser = ts_parser_new();
+        ts_parser_set_language(parser, language);
+        start = now();
+        TSTree *tree = ts_parser_parse_string(parser, NULL, text, size);
+        document->sequential_seconds = now() - start;
+        document->verified = true;
+        document->mismatch = compare(tree, document->blocks());
+        ts_tree_delete(tree);
+        ts_parser_delete(parser);
+    }
+    return document;
+}
+
+}  // namespace markdown
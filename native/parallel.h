@@ -0,0 +1,88 @@
+// Parallel parsing of a single large document.
+//
+// `parse_parallel` splits a document into chunks at safe points and parses the chunks
+// concurrently, one parser per thread. A safe point is the start of a line after a blank line at
+// which no block is open: no container like a list or block quote, no fenced code block and no
+// HTML block. At such a point the external scanner is in the same state as at the start of a
+// document, so a chunk starting there is parsed from scratch, with the rest of the document outside
+// of its included range. Nodes of all chunks have the byte offsets and points of the whole
+// document.
+//
+// Safe points are found in two steps. Candidates are lines after a blank line that start with a
+// character that cannot continue a container or start a list item. After parsing, the tree of the
+// chunk before a candidate tells whether the candidate really is a safe point: the chunk is parsed
+// up to the end of the line at the candidate, and a top level block has to start right at the
+// candidate with all earlier blocks ending before it. Chunks on both sides of a candidate that is
+// not a safe point are merged and parsed again, so that the result matches that of a
+// sequential parse. `ParallelOptions::verify` checks this against an actual sequential parse.
+// Documents without safe points, like one huge list, end up being parsed sequentially, after the
+// work on the rejected chunks has been wasted.
+
+#ifndef TREE_SITTER_MARKDOWN_PARALLEL_H_
+#define TREE_SITTER_MARKDOWN_PARALLEL_H_
+
+#include <tree_sitter/api.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+extern "C" const TSLanguage *tree_sitter_markdown();
+
+namespace markdown {
+
+struct ParallelOptions {
+    // Number of threads, 0 for one per hardware thread
+    unsigned threads;
+    // The grammar to parse with, `tree_sitter_markdown()` if NULL
+    const TSLanguage *language;
+    // Approximate size of a chunk in bytes, 0 for 256 KB. Documents are split into at most 4 chunks
+    // per thread, so chunks of large documents are bigger.
+    size_t chunk_size;
+    // Also parse the document sequentially and compare the top level blocks of both results
+    bool verify;
+};
+
+// The part of the document from `start_byte` up to `end_byte`, and its tree. The tree also covers
+// the first line after `end_byte`, which is needed to check the safe point.
+struct ParallelChunk {
+    uint32_t start_byte;
+    uint32_t end_byte;
+    TSPoint start_point;
+    TSPoint end_point;
+    TSTree *tree;
+};
+
+class ParallelDocument {
+  public:
+    std::vector<ParallelChunk> chunks;
+    // Number of candidates that turned out not to be safe points
+    size_t rejected_candidates;
+    // Wall clock time of the parallel parse
+    double seconds;
+
+    // Only set in verification mode. `mismatch` describes the first top level block that differs
+    // from the sequential parse, it is empty if there is none.
+    bool verified;
+    std::string mismatch;
+    double sequential_seconds;
+
+    ParallelDocument();
+    ~ParallelDocument();
+    ParallelDocument(const ParallelDocument &) = delete;
+    ParallelDocument &operator=(const ParallelDocument &) = delete;
+
+    // The top level blocks of the whole document in order. Each node belongs to the tree of its
+    // chunk, so it is valid as long as this document is.
+    std::vector<TSNode> blocks() const;
+};
+
+std::unique_ptr<ParallelDocument> parse_parallel(
+    const char *text,
+    size_t size,
+    const ParallelOptions &options = ParallelOptions()
+);
+
+}  // namespace markdown
+
+#endif  // TREE_SITTER_MARKDOWN_PARALLEL_H_
@@ -0,0 +1,97 @@
+// Command line tool for parallel parsing of a single document, see `parallel.h`.
+//
+// Parses a file in parallel, memory-mapped with `mapped_file.h`, and reports the chunks it was
+// split into, how many candidates for safe points were rejected and the time it took. With
+// `--verify` the file is also parsed sequentially, the speedup is reported and the tool fails if
+// the top level blocks differ.
+//
+// Build (after `tree-sitter generate` in the root and `block` directories, against an installed
+// tree-sitter runtime):
+//
+//     cc -O2 -std=c99 -Isrc -c src/parser.c -o parser.o
+//     cc -O2 -std=c99 -Iblock/src -c block/src/parser.c -o block_parser.o
+//     SOURCES="native/parallel_main.cc native/parallel.cc native/mapped_file.cc"
+//     PARSERS="src/scanner.cc block/src/scanner.cc parser.o block_parser.o"
+//     c++ -O2 -std=c++11 -pthread -Isrc $SOURCES $PARSERS -ltree-sitter -o markdown-parallel
+//
+// Usage:
+//
+//     ./markdown-parallel [--threads <n>] [--chunk-size <KB>] [--block] [--verify] [--chunks] <file>
+//
+// `--chunks` lists the byte range and starting line of every chunk.
+
+#include "parallel.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "mapped_file.h"
+
+extern "C" const TSLanguage *tree_sitter_markdown_block();
+
+int main(int argc, char **argv) {
+    markdown::ParallelOptions options = markdown::ParallelOptions();
+    bool list_chunks = false;
+    const char *file = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            options.threads = strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--chunk-size") == 0 && i + 1 < argc) {
+            options.chunk_size = strtoul(argv[++i], NULL, 10) * 1024;
+        } else if (strcmp(argv[i], "--block") == 0) {
+            options.language = tree_sitter_markdown_block();
+        } else if (strcmp(argv[i], "--verify") == 0) {
+            options.verify = true;
+        } else if (strcmp(argv[i], "--chunks") == 0) {
+            list_chunks = true;
+        } else {
+            file = argv[i];
+        }
+    }
+    if (!file) {
+        fprintf(stderr, "usage: %s [--threads <n>] [--chunk-size <KB>] [--block] [--verify] [--chunks] <file>\n", argv[0]);
+        return 1;
+    }
+    std::string error;
+    std::unique_ptr<markdown::MappedFile> mapped = markdown::MappedFile::open(file, error);
+    if (!mapped) {
+        fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+
+    std::unique_ptr<markdown::ParallelDocument> document =
+        markdown::parse_parallel(mapped->text, mapped->size, options);
+    if (list_chunks) {
+        for (const markdown::ParallelChunk &chunk : document->chunks) {
+            printf(
+                "%10u %10u  line %u\n",
+                chunk.start_byte,
+                chunk.end_byte,
+                chunk.start_point.row + 1
+            );
+        }
+    }
+    double megabytes = mapped->size / (1024.0 * 1024.0);
+    printf(
+        "%s: %.2f MB, %zu chunks, %zu rejected candidates, %.3f s (%.2f MB/s)\n",
+        file,
+        megabytes,
+        document->chunks.size(),
+        document->rejected_candidates,
+        document->seconds,
+        megabytes / document->seconds
+    );
+    if (!document->verified) return 0;
+
+    printf(
+        "sequential: %.3f s (%.2f MB/s), speedup %.2f\n",
+        document->sequential_seconds,
+        megabytes / document->sequential_seconds,
+        document->sequential_seconds / document->seconds
+    );
+    if (!document->mismatch.empty()) {
+        printf("MISMATCH: %s\n", document->mismatch.c_str());
+        return 1;
+    }
+    printf("identical to the sequential parse\n");
+    return 0;
+}
@@ -0,0 +1,48 @@
+// Generates the seed corpus for the fuzzer in `fuzz/fuzzer.cc`: one file per example of the
+// tree-sitter corpus files `corpus/*.txt`, containing only the input of the example.
+//
+// Every example consists of a header delimited by lines of `=`, the input and the expected output,
+// which are separated by a line of `-`. Like `tree-sitter test` the newline right before the
+// divider is dropped.
+//
+// Usage: node script/generate-fuzz-corpus.js <output directory>
+
+const fs = require('fs');
+const path = require('path');
+
+const root = path.join(__dirname, '..');
+const output = process.argv[2];
+if (!output) {
+    console.error('usage: node script/generate-fuzz-corpus.js <output directory>');
+    process.exit(1);
+}
+fs.mkdirSync(output, { recursive: true });
+
+function examples(text) {
+    const result = [];
+    let part = 'expected';
+    let input = [];
+    for (const line of text.split('\n')) {
+        if (part !== 'input' && line.startsWith('===')) {
+            part = part === 'header' ? 'input' : 'header';
+            input = [];
+        } else if (part === 'input' && line.startsWith('---')) {
+            result.push(input.join('\n'));
+            part = 'expected';
+        } else if (part === 'input') {
+            input.push(line);
+        }
+    }
+    return result;
+}
+
+const corpus = path.join(root, 'corpus');
+let count = 0;
+for (const file of fs.readdirSync(corpus).filter(file => file.endsWith('.txt')).sort()) {
+    const name = path.basename(file, '.txt');
+    examples(fs.readFileSync(path.join(corpus, file), 'utf8')).forEach((input, i) => {
+        fs.writeFileSync(path.join(output, `${name}-${i + 1}.md`), input);
+        count++;
+    });
+}
+console.log(`wrote ${count} inputs to ${output}`);
@@ -0,0 +1,145 @@
+// Generates `src/html_entities.h`, the table of html entity names used by the external scanner to
+// recognize entity references (https://github.github.com/gfm/#entity-and-numeric-character-references).
+//
+// The names are taken from `html_entities.json`, which should be kept up to date with
+// https://html.spec.whatwg.org/multipage/entities.json. Only names ending in a semicolon are valid
+// in markdown.
+//
+// The table is a minimal perfect hash built with the hash and displace algorithm: a first hash of
+// the name selects a bucket, which stores a seed for a second hash that maps the name to a slot of
+// its own. Looking up a name thus costs two hashes and one string comparison.
+//
+// Usage: node script/generate-html-entities.js
+
+const fs = require('fs');
+const path = require('path');
+
+const root = path.join(__dirname, '..');
+const entities = require(path.join(root, 'html_entities.json'));
+
+const names = Object.keys(entities)
+    .filter(name => name.endsWith(';'))
+    .map(name => name.substring(1, name.length - 1));
+
+// Must match `html_entity_hash` in the generated header
+function hash(name, seed) {
+    let h = (2166136261 ^ seed) >>> 0;
+    for (let i = 0; i < name.length; i++) {
+        h = Math.imul(h ^ name.charCodeAt(i), 16777619) >>> 0;
+    }
+    return h;
+}
+
+function power_of_two(n) {
+    let result = 1;
+    while (result < n) result *= 2;
+    return result;
+}
+
+const slot_count = power_of_two(names.length);
+const bucket_count = power_of_two(names.length / 4);
+
+const buckets = [];
+for (let i = 0; i < bucket_count; i++) buckets.push([]);
+for (const name of names) {
+    buckets[hash(name, 0) & (bucket_count - 1)].push(name);
+}
+
+// Place the largest buckets first, while most slots are still free
+const order = buckets.map((bucket, index) => index).sort((a, b) => buckets[b].length - buckets[a].length);
+const seeds = new Array(bucket_count).fill(0);
+const slots = new Array(slot_count).fill(null);
+for (const index of order) {
+    const bucket = buckets[index];
+    if (bucket.length === 0) break;
+    for (let seed = 1; ; seed++) {
+        if (seed > 0xff) throw new Error('could not place bucket ' + index);
+        const positions = bucket.map(name => hash(name, seed) & (slot_count - 1));
+        if (positions.some((position, i) => slots[position] !== null || positions.indexOf(position) !== i)) {
+            continue;
+        }
+        positions.forEach((position, i) => slots[position] = bucket[i]);
+        seeds[index] = seed;
+        break;
+    }
+}
+
+// All names are stored in one string, separated by NUL characters. Slots refer to the offsets of
+// the names in this string.
+let pool = '';
+const offsets = {};
+for (const name of names.slice().sort()) {
+    offsets[name] = pool.length;
+    pool += name + '\0';
+}
+if (pool.length >= 0xffff) throw new Error('name pool too large');
+
+const max_length = Math.max(...names.map(name => name.length));
+
+function columns(values, width) {
+    const lines = [];
+    for (let i = 0; i < values.length; i += width) {
+        lines.push('    ' + values.slice(i, i + width).join(', ') + ',');
+    }
+    return lines.join('\n');
+}
+
+const pool_lines = [];
+let line = '';
+for (const name of names.slice().sort()) {
+    const literal = '"' + name + '\\0"';
+    if (line.length + literal.length > 96) {
+        pool_lines.push('    ' + line.trimEnd());
+        line = '';
+    }
+    line += literal + ' ';
+}
+pool_lines.push('    ' + line.trimEnd());
+
+const output = `// Generated by script/generate-html-entities.js from html_entities.json. Do not edit.
+
+#ifndef TREE_SITTER_MARKDOWN_HTML_ENTITIES_H_
+#define TREE_SITTER_MARKDOWN_HTML_ENTITIES_H_
+
+#include <stdint.h>
+#include <string.h>
+
+// Length of the longest entity name, without the \`&\` and \`;\`
+#define HTML_ENTITY_MAX_LENGTH ${max_length}
+
+#define HTML_ENTITY_BUCKET_COUNT ${bucket_count}
+#define HTML_ENTITY_SLOT_COUNT ${slot_count}
+#define HTML_ENTITY_EMPTY_SLOT 0xffff
+
+static const char HTML_ENTITY_NAMES[] =
+${pool_lines.join('\n')};
+
+static const uint8_t HTML_ENTITY_SEEDS[HTML_ENTITY_BUCKET_COUNT] = {
+${columns(seeds, 16)}
+};
+
+static const uint16_t HTML_ENTITY_SLOTS[HTML_ENTITY_SLOT_COUNT] = {
+${columns(slots.map(name => name === null ? 'HTML_ENTITY_EMPTY_SLOT' : offsets[name]), 12)}
+};
+
+static inline uint32_t html_entity_hash(const char *name, uint32_t length, uint32_t seed) {
+    uint32_t hash = 2166136261u ^ seed;
+    for (uint32_t i = 0; i < length; i++) {
+        hash = (hash ^ (unsigned char)name[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Determines if \`name\` (without the \`&\` and \`;\`) is the name of an html entity.
+static inline bool is_html_entity(const char *name, uint32_t length) {
+    uint32_t bucket = html_entity_hash(name, length, 0) & (HTML_ENTITY_BUCKET_COUNT - 1);
+    uint32_t slot = html_entity_hash(name, length, HTML_ENTITY_SEEDS[bucket]) & (HTML_ENTITY_SLOT_COUNT - 1);
+    if (HTML_ENTITY_SLOTS[slot] == HTML_ENTITY_EMPTY_SLOT) return false;
+    const char *candidate = HTML_ENTITY_NAMES + HTML_ENTITY_SLOTS[slot];
+    return strncmp(candidate, name, length) == 0 && candidate[length] == '\\0';
+}
+
+#endif  // TREE_SITTER_MARKDOWN_HTML_ENTITIES_H_
+`;
+
+fs.writeFileSync(path.join(root, 'src', 'html_entities.h'), output);
@@ -0,0 +1,718 @@
+// Generated by script/generate-html-entities.js from html_entities.json. Do not edit.
+
+#ifndef TREE_SITTER_MARKDOWN_HTML_ENTITIES_H_
+#define TREE_SITTER_MARKDOWN_HTML_ENTITIES_H_
+
+#include <stdint.h>
+#include <string.h>
+
+// Length of the longest entity name, without the `&` and `;`
+#define HTML_ENTITY_MAX_LENGTH 31
+
+#define HTML_ENTITY_BUCKET_COUNT 1024
+#define HTML_ENTITY_SLOT_COUNT 4096
+#define HTML_ENTITY_EMPTY_SLOT 0xffff
+
+static const char HTML_ENTITY_NAMES[] =
+    "AElig\0" "AMP\0" "Aacute\0" "Abreve\0" "Acirc\0" "Acy\0" "Afr\0" "Agrave\0" "Alpha\0" "Amacr\0"
+    "And\0" "Aogon\0" "Aopf\0" "ApplyFunction\0" "Aring\0" "Ascr\0" "Assign\0" "Atilde\0" "Auml\0"
+    "Backslash\0" "Barv\0" "Barwed\0" "Bcy\0" "Because\0" "Bernoullis\0" "Beta\0" "Bfr\0" "Bopf\0"
+    "Breve\0" "Bscr\0" "Bumpeq\0" "CHcy\0" "COPY\0" "Cacute\0" "Cap\0" "CapitalDifferentialD\0"
+    "Cayleys\0" "Ccaron\0" "Ccedil\0" "Ccirc\0" "Cconint\0" "Cdot\0" "Cedilla\0" "CenterDot\0"
+    "Cfr\0" "Chi\0" "CircleDot\0" "CircleMinus\0" "CirclePlus\0" "CircleTimes\0"
+    "ClockwiseContourIntegral\0" "CloseCurlyDoubleQuote\0" "CloseCurlyQuote\0" "Colon\0" "Colone\0"
+    "Congruent\0" "Conint\0" "ContourIntegral\0" "Copf\0" "Coproduct\0"
+    "CounterClockwiseContourIntegral\0" "Cross\0" "Cscr\0" "Cup\0" "CupCap\0" "DD\0" "DDotrahd\0"
+    "DJcy\0" "DScy\0" "DZcy\0" "Dagger\0" "Darr\0" "Dashv\0" "Dcaron\0" "Dcy\0" "Del\0" "Delta\0"
+    "Dfr\0" "DiacriticalAcute\0" "DiacriticalDot\0" "DiacriticalDoubleAcute\0" "DiacriticalGrave\0"
+    "DiacriticalTilde\0" "Diamond\0" "DifferentialD\0" "Dopf\0" "Dot\0" "DotDot\0" "DotEqual\0"
+    "DoubleContourIntegral\0" "DoubleDot\0" "DoubleDownArrow\0" "DoubleLeftArrow\0"
+    "DoubleLeftRightArrow\0" "DoubleLeftTee\0" "DoubleLongLeftArrow\0" "DoubleLongLeftRightArrow\0"
+    "DoubleLongRightArrow\0" "DoubleRightArrow\0" "DoubleRightTee\0" "DoubleUpArrow\0"
+    "DoubleUpDownArrow\0" "DoubleVerticalBar\0" "DownArrow\0" "DownArrowBar\0" "DownArrowUpArrow\0"
+    "DownBreve\0" "DownLeftRightVector\0" "DownLeftTeeVector\0" "DownLeftVector\0"
+    "DownLeftVectorBar\0" "DownRightTeeVector\0" "DownRightVector\0" "DownRightVectorBar\0"
+    "DownTee\0" "DownTeeArrow\0" "Downarrow\0" "Dscr\0" "Dstrok\0" "ENG\0" "ETH\0" "Eacute\0"
+    "Ecaron\0" "Ecirc\0" "Ecy\0" "Edot\0" "Efr\0" "Egrave\0" "Element\0" "Emacr\0"
+    "EmptySmallSquare\0" "EmptyVerySmallSquare\0" "Eogon\0" "Eopf\0" "Epsilon\0" "Equal\0"
+    "EqualTilde\0" "Equilibrium\0" "Escr\0" "Esim\0" "Eta\0" "Euml\0" "Exists\0" "ExponentialE\0"
+    "Fcy\0" "Ffr\0" "FilledSmallSquare\0" "FilledVerySmallSquare\0" "Fopf\0" "ForAll\0"
+    "Fouriertrf\0" "Fscr\0" "GJcy\0" "GT\0" "Gamma\0" "Gammad\0" "Gbreve\0" "Gcedil\0" "Gcirc\0"
+    "Gcy\0" "Gdot\0" "Gfr\0" "Gg\0" "Gopf\0" "GreaterEqual\0" "GreaterEqualLess\0"
+    "GreaterFullEqual\0" "GreaterGreater\0" "GreaterLess\0" "GreaterSlantEqual\0" "GreaterTilde\0"
+    "Gscr\0" "Gt\0" "HARDcy\0" "Hacek\0" "Hat\0" "Hcirc\0" "Hfr\0" "HilbertSpace\0" "Hopf\0"
+    "HorizontalLine\0" "Hscr\0" "Hstrok\0" "HumpDownHump\0" "HumpEqual\0" "IEcy\0" "IJlig\0"
+    "IOcy\0" "Iacute\0" "Icirc\0" "Icy\0" "Idot\0" "Ifr\0" "Igrave\0" "Im\0" "Imacr\0"
+    "ImaginaryI\0" "Implies\0" "Int\0" "Integral\0" "Intersection\0" "InvisibleComma\0"
+    "InvisibleTimes\0" "Iogon\0" "Iopf\0" "Iota\0" "Iscr\0" "Itilde\0" "Iukcy\0" "Iuml\0" "Jcirc\0"
+    "Jcy\0" "Jfr\0" "Jopf\0" "Jscr\0" "Jsercy\0" "Jukcy\0" "KHcy\0" "KJcy\0" "Kappa\0" "Kcedil\0"
+    "Kcy\0" "Kfr\0" "Kopf\0" "Kscr\0" "LJcy\0" "LT\0" "Lacute\0" "Lambda\0" "Lang\0" "Laplacetrf\0"
+    "Larr\0" "Lcaron\0" "Lcedil\0" "Lcy\0" "LeftAngleBracket\0" "LeftArrow\0" "LeftArrowBar\0"
+    "LeftArrowRightArrow\0" "LeftCeiling\0" "LeftDoubleBracket\0" "LeftDownTeeVector\0"
+    "LeftDownVector\0" "LeftDownVectorBar\0" "LeftFloor\0" "LeftRightArrow\0" "LeftRightVector\0"
+    "LeftTee\0" "LeftTeeArrow\0" "LeftTeeVector\0" "LeftTriangle\0" "LeftTriangleBar\0"
+    "LeftTriangleEqual\0" "LeftUpDownVector\0" "LeftUpTeeVector\0" "LeftUpVector\0"
+    "LeftUpVectorBar\0" "LeftVector\0" "LeftVectorBar\0" "Leftarrow\0" "Leftrightarrow\0"
+    "LessEqualGreater\0" "LessFullEqual\0" "LessGreater\0" "LessLess\0" "LessSlantEqual\0"
+    "LessTilde\0" "Lfr\0" "Ll\0" "Lleftarrow\0" "Lmidot\0" "LongLeftArrow\0" "LongLeftRightArrow\0"
+    "LongRightArrow\0" "Longleftarrow\0" "Longleftrightarrow\0" "Longrightarrow\0" "Lopf\0"
+    "LowerLeftArrow\0" "LowerRightArrow\0" "Lscr\0" "Lsh\0" "Lstrok\0" "Lt\0" "Map\0" "Mcy\0"
+    "MediumSpace\0" "Mellintrf\0" "Mfr\0" "MinusPlus\0" "Mopf\0" "Mscr\0" "Mu\0" "NJcy\0" "Nacute\0"
+    "Ncaron\0" "Ncedil\0" "Ncy\0" "NegativeMediumSpace\0" "NegativeThickSpace\0"
+    "NegativeThinSpace\0" "NegativeVeryThinSpace\0" "NestedGreaterGreater\0" "NestedLessLess\0"
+    "NewLine\0" "Nfr\0" "NoBreak\0" "NonBreakingSpace\0" "Nopf\0" "Not\0" "NotCongruent\0"
+    "NotCupCap\0" "NotDoubleVerticalBar\0" "NotElement\0" "NotEqual\0" "NotEqualTilde\0"
+    "NotExists\0" "NotGreater\0" "NotGreaterEqual\0" "NotGreaterFullEqual\0" "NotGreaterGreater\0"
+    "NotGreaterLess\0" "NotGreaterSlantEqual\0" "NotGreaterTilde\0" "NotHumpDownHump\0"
+    "NotHumpEqual\0" "NotLeftTriangle\0" "NotLeftTriangleBar\0" "NotLeftTriangleEqual\0" "NotLess\0"
+    "NotLessEqual\0" "NotLessGreater\0" "NotLessLess\0" "NotLessSlantEqual\0" "NotLessTilde\0"
+    "NotNestedGreaterGreater\0" "NotNestedLessLess\0" "NotPrecedes\0" "NotPrecedesEqual\0"
+    "NotPrecedesSlantEqual\0" "NotReverseElement\0" "NotRightTriangle\0" "NotRightTriangleBar\0"
+    "NotRightTriangleEqual\0" "NotSquareSubset\0" "NotSquareSubsetEqual\0" "NotSquareSuperset\0"
+    "NotSquareSupersetEqual\0" "NotSubset\0" "NotSubsetEqual\0" "NotSucceeds\0" "NotSucceedsEqual\0"
+    "NotSucceedsSlantEqual\0" "NotSucceedsTilde\0" "NotSuperset\0" "NotSupersetEqual\0" "NotTilde\0"
+    "NotTildeEqual\0" "NotTildeFullEqual\0" "NotTildeTilde\0" "NotVerticalBar\0" "Nscr\0" "Ntilde\0"
+    "Nu\0" "OElig\0" "Oacute\0" "Ocirc\0" "Ocy\0" "Odblac\0" "Ofr\0" "Ograve\0" "Omacr\0" "Omega\0"
+    "Omicron\0" "Oopf\0" "OpenCurlyDoubleQuote\0" "OpenCurlyQuote\0" "Or\0" "Oscr\0" "Oslash\0"
+    "Otilde\0" "Otimes\0" "Ouml\0" "OverBar\0" "OverBrace\0" "OverBracket\0" "OverParenthesis\0"
+    "PartialD\0" "Pcy\0" "Pfr\0" "Phi\0" "Pi\0" "PlusMinus\0" "Poincareplane\0" "Popf\0" "Pr\0"
+    "Precedes\0" "PrecedesEqual\0" "PrecedesSlantEqual\0" "PrecedesTilde\0" "Prime\0" "Product\0"
+    "Proportion\0" "Proportional\0" "Pscr\0" "Psi\0" "QUOT\0" "Qfr\0" "Qopf\0" "Qscr\0" "RBarr\0"
+    "REG\0" "Racute\0" "Rang\0" "Rarr\0" "Rarrtl\0" "Rcaron\0" "Rcedil\0" "Rcy\0" "Re\0"
+    "ReverseElement\0" "ReverseEquilibrium\0" "ReverseUpEquilibrium\0" "Rfr\0" "Rho\0"
+    "RightAngleBracket\0" "RightArrow\0" "RightArrowBar\0" "RightArrowLeftArrow\0" "RightCeiling\0"
+    "RightDoubleBracket\0" "RightDownTeeVector\0" "RightDownVector\0" "RightDownVectorBar\0"
+    "RightFloor\0" "RightTee\0" "RightTeeArrow\0" "RightTeeVector\0" "RightTriangle\0"
+    "RightTriangleBar\0" "RightTriangleEqual\0" "RightUpDownVector\0" "RightUpTeeVector\0"
+    "RightUpVector\0" "RightUpVectorBar\0" "RightVector\0" "RightVectorBar\0" "Rightarrow\0"
+    "Ropf\0" "RoundImplies\0" "Rrightarrow\0" "Rscr\0" "Rsh\0" "RuleDelayed\0" "SHCHcy\0" "SHcy\0"
+    "SOFTcy\0" "Sacute\0" "Sc\0" "Scaron\0" "Scedil\0" "Scirc\0" "Scy\0" "Sfr\0" "ShortDownArrow\0"
+    "ShortLeftArrow\0" "ShortRightArrow\0" "ShortUpArrow\0" "Sigma\0" "SmallCircle\0" "Sopf\0"
+    "Sqrt\0" "Square\0" "SquareIntersection\0" "SquareSubset\0" "SquareSubsetEqual\0"
+    "SquareSuperset\0" "SquareSupersetEqual\0" "SquareUnion\0" "Sscr\0" "Star\0" "Sub\0" "Subset\0"
+    "SubsetEqual\0" "Succeeds\0" "SucceedsEqual\0" "SucceedsSlantEqual\0" "SucceedsTilde\0"
+    "SuchThat\0" "Sum\0" "Sup\0" "Superset\0" "SupersetEqual\0" "Supset\0" "THORN\0" "TRADE\0"
+    "TSHcy\0" "TScy\0" "Tab\0" "Tau\0" "Tcaron\0" "Tcedil\0" "Tcy\0" "Tfr\0" "Therefore\0" "Theta\0"
+    "ThickSpace\0" "ThinSpace\0" "Tilde\0" "TildeEqual\0" "TildeFullEqual\0" "TildeTilde\0" "Topf\0"
+    "TripleDot\0" "Tscr\0" "Tstrok\0" "Uacute\0" "Uarr\0" "Uarrocir\0" "Ubrcy\0" "Ubreve\0"
+    "Ucirc\0" "Ucy\0" "Udblac\0" "Ufr\0" "Ugrave\0" "Umacr\0" "UnderBar\0" "UnderBrace\0"
+    "UnderBracket\0" "UnderParenthesis\0" "Union\0" "UnionPlus\0" "Uogon\0" "Uopf\0" "UpArrow\0"
+    "UpArrowBar\0" "UpArrowDownArrow\0" "UpDownArrow\0" "UpEquilibrium\0" "UpTee\0" "UpTeeArrow\0"
+    "Uparrow\0" "Updownarrow\0" "UpperLeftArrow\0" "UpperRightArrow\0" "Upsi\0" "Upsilon\0"
+    "Uring\0" "Uscr\0" "Utilde\0" "Uuml\0" "VDash\0" "Vbar\0" "Vcy\0" "Vdash\0" "Vdashl\0" "Vee\0"
+    "Verbar\0" "Vert\0" "VerticalBar\0" "VerticalLine\0" "VerticalSeparator\0" "VerticalTilde\0"
+    "VeryThinSpace\0" "Vfr\0" "Vopf\0" "Vscr\0" "Vvdash\0" "Wcirc\0" "Wedge\0" "Wfr\0" "Wopf\0"
+    "Wscr\0" "Xfr\0" "Xi\0" "Xopf\0" "Xscr\0" "YAcy\0" "YIcy\0" "YUcy\0" "Yacute\0" "Ycirc\0"
+    "Ycy\0" "Yfr\0" "Yopf\0" "Yscr\0" "Yuml\0" "ZHcy\0" "Zacute\0" "Zcaron\0" "Zcy\0" "Zdot\0"
+    "ZeroWidthSpace\0" "Zeta\0" "Zfr\0" "Zopf\0" "Zscr\0" "aacute\0" "abreve\0" "ac\0" "acE\0"
+    "acd\0" "acirc\0" "acute\0" "acy\0" "aelig\0" "af\0" "afr\0" "agrave\0" "alefsym\0" "aleph\0"
+    "alpha\0" "amacr\0" "amalg\0" "amp\0" "and\0" "andand\0" "andd\0" "andslope\0" "andv\0" "ang\0"
+    "ange\0" "angle\0" "angmsd\0" "angmsdaa\0" "angmsdab\0" "angmsdac\0" "angmsdad\0" "angmsdae\0"
+    "angmsdaf\0" "angmsdag\0" "angmsdah\0" "angrt\0" "angrtvb\0" "angrtvbd\0" "angsph\0" "angst\0"
+    "angzarr\0" "aogon\0" "aopf\0" "ap\0" "apE\0" "apacir\0" "ape\0" "apid\0" "apos\0" "approx\0"
+    "approxeq\0" "aring\0" "ascr\0" "ast\0" "asymp\0" "asympeq\0" "atilde\0" "auml\0" "awconint\0"
+    "awint\0" "bNot\0" "backcong\0" "backepsilon\0" "backprime\0" "backsim\0" "backsimeq\0"
+    "barvee\0" "barwed\0" "barwedge\0" "bbrk\0" "bbrktbrk\0" "bcong\0" "bcy\0" "bdquo\0" "becaus\0"
+    "because\0" "bemptyv\0" "bepsi\0" "bernou\0" "beta\0" "beth\0" "between\0" "bfr\0" "bigcap\0"
+    "bigcirc\0" "bigcup\0" "bigodot\0" "bigoplus\0" "bigotimes\0" "bigsqcup\0" "bigstar\0"
+    "bigtriangledown\0" "bigtriangleup\0" "biguplus\0" "bigvee\0" "bigwedge\0" "bkarow\0"
+    "blacklozenge\0" "blacksquare\0" "blacktriangle\0" "blacktriangledown\0" "blacktriangleleft\0"
+    "blacktriangleright\0" "blank\0" "blk12\0" "blk14\0" "blk34\0" "block\0" "bne\0" "bnequiv\0"
+    "bnot\0" "bopf\0" "bot\0" "bottom\0" "bowtie\0" "boxDL\0" "boxDR\0" "boxDl\0" "boxDr\0" "boxH\0"
+    "boxHD\0" "boxHU\0" "boxHd\0" "boxHu\0" "boxUL\0" "boxUR\0" "boxUl\0" "boxUr\0" "boxV\0"
+    "boxVH\0" "boxVL\0" "boxVR\0" "boxVh\0" "boxVl\0" "boxVr\0" "boxbox\0" "boxdL\0" "boxdR\0"
+    "boxdl\0" "boxdr\0" "boxh\0" "boxhD\0" "boxhU\0" "boxhd\0" "boxhu\0" "boxminus\0" "boxplus\0"
+    "boxtimes\0" "boxuL\0" "boxuR\0" "boxul\0" "boxur\0" "boxv\0" "boxvH\0" "boxvL\0" "boxvR\0"
+    "boxvh\0" "boxvl\0" "boxvr\0" "bprime\0" "breve\0" "brvbar\0" "bscr\0" "bsemi\0" "bsim\0"
+    "bsime\0" "bsol\0" "bsolb\0" "bsolhsub\0" "bull\0" "bullet\0" "bump\0" "bumpE\0" "bumpe\0"
+    "bumpeq\0" "cacute\0" "cap\0" "capand\0" "capbrcup\0" "capcap\0" "capcup\0" "capdot\0" "caps\0"
+    "caret\0" "caron\0" "ccaps\0" "ccaron\0" "ccedil\0" "ccirc\0" "ccups\0" "ccupssm\0" "cdot\0"
+    "cedil\0" "cemptyv\0" "cent\0" "centerdot\0" "cfr\0" "chcy\0" "check\0" "checkmark\0" "chi\0"
+    "cir\0" "cirE\0" "circ\0" "circeq\0" "circlearrowleft\0" "circlearrowright\0" "circledR\0"
+    "circledS\0" "circledast\0" "circledcirc\0" "circleddash\0" "cire\0" "cirfnint\0" "cirmid\0"
+    "cirscir\0" "clubs\0" "clubsuit\0" "colon\0" "colone\0" "coloneq\0" "comma\0" "commat\0"
+    "comp\0" "compfn\0" "complement\0" "complexes\0" "cong\0" "congdot\0" "conint\0" "copf\0"
+    "coprod\0" "copy\0" "copysr\0" "crarr\0" "cross\0" "cscr\0" "csub\0" "csube\0" "csup\0"
+    "csupe\0" "ctdot\0" "cudarrl\0" "cudarrr\0" "cuepr\0" "cuesc\0" "cularr\0" "cularrp\0" "cup\0"
+    "cupbrcap\0" "cupcap\0" "cupcup\0" "cupdot\0" "cupor\0" "cups\0" "curarr\0" "curarrm\0"
+    "curlyeqprec\0" "curlyeqsucc\0" "curlyvee\0" "curlywedge\0" "curren\0" "curvearrowleft\0"
+    "curvearrowright\0" "cuvee\0" "cuwed\0" "cwconint\0" "cwint\0" "cylcty\0" "dArr\0" "dHar\0"
+    "dagger\0" "daleth\0" "darr\0" "dash\0" "dashv\0" "dbkarow\0" "dblac\0" "dcaron\0" "dcy\0"
+    "dd\0" "ddagger\0" "ddarr\0" "ddotseq\0" "deg\0" "delta\0" "demptyv\0" "dfisht\0" "dfr\0"
+    "dharl\0" "dharr\0" "diam\0" "diamond\0" "diamondsuit\0" "diams\0" "die\0" "digamma\0" "disin\0"
+    "div\0" "divide\0" "divideontimes\0" "divonx\0" "djcy\0" "dlcorn\0" "dlcrop\0" "dollar\0"
+    "dopf\0" "dot\0" "doteq\0" "doteqdot\0" "dotminus\0" "dotplus\0" "dotsquare\0"
+    "doublebarwedge\0" "downarrow\0" "downdownarrows\0" "downharpoonleft\0" "downharpoonright\0"
+    "drbkarow\0" "drcorn\0" "drcrop\0" "dscr\0" "dscy\0" "dsol\0" "dstrok\0" "dtdot\0" "dtri\0"
+    "dtrif\0" "duarr\0" "duhar\0" "dwangle\0" "dzcy\0" "dzigrarr\0" "eDDot\0" "eDot\0" "eacute\0"
+    "easter\0" "ecaron\0" "ecir\0" "ecirc\0" "ecolon\0" "ecy\0" "edot\0" "ee\0" "efDot\0" "efr\0"
+    "eg\0" "egrave\0" "egs\0" "egsdot\0" "el\0" "elinters\0" "ell\0" "els\0" "elsdot\0" "emacr\0"
+    "empty\0" "emptyset\0" "emptyv\0" "emsp\0" "emsp13\0" "emsp14\0" "eng\0" "ensp\0" "eogon\0"
+    "eopf\0" "epar\0" "eparsl\0" "eplus\0" "epsi\0" "epsilon\0" "epsiv\0" "eqcirc\0" "eqcolon\0"
+    "eqsim\0" "eqslantgtr\0" "eqslantless\0" "equals\0" "equest\0" "equiv\0" "equivDD\0"
+    "eqvparsl\0" "erDot\0" "erarr\0" "escr\0" "esdot\0" "esim\0" "eta\0" "eth\0" "euml\0" "euro\0"
+    "excl\0" "exist\0" "expectation\0" "exponentiale\0" "fallingdotseq\0" "fcy\0" "female\0"
+    "ffilig\0" "fflig\0" "ffllig\0" "ffr\0" "filig\0" "fjlig\0" "flat\0" "fllig\0" "fltns\0"
+    "fnof\0" "fopf\0" "forall\0" "fork\0" "forkv\0" "fpartint\0" "frac12\0" "frac13\0" "frac14\0"
+    "frac15\0" "frac16\0" "frac18\0" "frac23\0" "frac25\0" "frac34\0" "frac35\0" "frac38\0"
+    "frac45\0" "frac56\0" "frac58\0" "frac78\0" "frasl\0" "frown\0" "fscr\0" "gE\0" "gEl\0"
+    "gacute\0" "gamma\0" "gammad\0" "gap\0" "gbreve\0" "gcirc\0" "gcy\0" "gdot\0" "ge\0" "gel\0"
+    "geq\0" "geqq\0" "geqslant\0" "ges\0" "gescc\0" "gesdot\0" "gesdoto\0" "gesdotol\0" "gesl\0"
+    "gesles\0" "gfr\0" "gg\0" "ggg\0" "gimel\0" "gjcy\0" "gl\0" "glE\0" "gla\0" "glj\0" "gnE\0"
+    "gnap\0" "gnapprox\0" "gne\0" "gneq\0" "gneqq\0" "gnsim\0" "gopf\0" "grave\0" "gscr\0" "gsim\0"
+    "gsime\0" "gsiml\0" "gt\0" "gtcc\0" "gtcir\0" "gtdot\0" "gtlPar\0" "gtquest\0" "gtrapprox\0"
+    "gtrarr\0" "gtrdot\0" "gtreqless\0" "gtreqqless\0" "gtrless\0" "gtrsim\0" "gvertneqq\0" "gvnE\0"
+    "hArr\0" "hairsp\0" "half\0" "hamilt\0" "hardcy\0" "harr\0" "harrcir\0" "harrw\0" "hbar\0"
+    "hcirc\0" "hearts\0" "heartsuit\0" "hellip\0" "hercon\0" "hfr\0" "hksearow\0" "hkswarow\0"
+    "hoarr\0" "homtht\0" "hookleftarrow\0" "hookrightarrow\0" "hopf\0" "horbar\0" "hscr\0"
+    "hslash\0" "hstrok\0" "hybull\0" "hyphen\0" "iacute\0" "ic\0" "icirc\0" "icy\0" "iecy\0"
+    "iexcl\0" "iff\0" "ifr\0" "igrave\0" "ii\0" "iiiint\0" "iiint\0" "iinfin\0" "iiota\0" "ijlig\0"
+    "imacr\0" "image\0" "imagline\0" "imagpart\0" "imath\0" "imof\0" "imped\0" "in\0" "incare\0"
+    "infin\0" "infintie\0" "inodot\0" "int\0" "intcal\0" "integers\0" "intercal\0" "intlarhk\0"
+    "intprod\0" "iocy\0" "iogon\0" "iopf\0" "iota\0" "iprod\0" "iquest\0" "iscr\0" "isin\0"
+    "isinE\0" "isindot\0" "isins\0" "isinsv\0" "isinv\0" "it\0" "itilde\0" "iukcy\0" "iuml\0"
+    "jcirc\0" "jcy\0" "jfr\0" "jmath\0" "jopf\0" "jscr\0" "jsercy\0" "jukcy\0" "kappa\0" "kappav\0"
+    "kcedil\0" "kcy\0" "kfr\0" "kgreen\0" "khcy\0" "kjcy\0" "kopf\0" "kscr\0" "lAarr\0" "lArr\0"
+    "lAtail\0" "lBarr\0" "lE\0" "lEg\0" "lHar\0" "lacute\0" "laemptyv\0" "lagran\0" "lambda\0"
+    "lang\0" "langd\0" "langle\0" "lap\0" "laquo\0" "larr\0" "larrb\0" "larrbfs\0" "larrfs\0"
+    "larrhk\0" "larrlp\0" "larrpl\0" "larrsim\0" "larrtl\0" "lat\0" "latail\0" "late\0" "lates\0"
+    "lbarr\0" "lbbrk\0" "lbrace\0" "lbrack\0" "lbrke\0" "lbrksld\0" "lbrkslu\0" "lcaron\0"
+    "lcedil\0" "lceil\0" "lcub\0" "lcy\0" "ldca\0" "ldquo\0" "ldquor\0" "ldrdhar\0" "ldrushar\0"
+    "ldsh\0" "le\0" "leftarrow\0" "leftarrowtail\0" "leftharpoondown\0" "leftharpoonup\0"
+    "leftleftarrows\0" "leftrightarrow\0" "leftrightarrows\0" "leftrightharpoons\0"
+    "leftrightsquigarrow\0" "leftthreetimes\0" "leg\0" "leq\0" "leqq\0" "leqslant\0" "les\0"
+    "lescc\0" "lesdot\0" "lesdoto\0" "lesdotor\0" "lesg\0" "lesges\0" "lessapprox\0" "lessdot\0"
+    "lesseqgtr\0" "lesseqqgtr\0" "lessgtr\0" "lesssim\0" "lfisht\0" "lfloor\0" "lfr\0" "lg\0"
+    "lgE\0" "lhard\0" "lharu\0" "lharul\0" "lhblk\0" "ljcy\0" "ll\0" "llarr\0" "llcorner\0"
+    "llhard\0" "lltri\0" "lmidot\0" "lmoust\0" "lmoustache\0" "lnE\0" "lnap\0" "lnapprox\0" "lne\0"
+    "lneq\0" "lneqq\0" "lnsim\0" "loang\0" "loarr\0" "lobrk\0" "longleftarrow\0"
+    "longleftrightarrow\0" "longmapsto\0" "longrightarrow\0" "looparrowleft\0" "looparrowright\0"
+    "lopar\0" "lopf\0" "loplus\0" "lotimes\0" "lowast\0" "lowbar\0" "loz\0" "lozenge\0" "lozf\0"
+    "lpar\0" "lparlt\0" "lrarr\0" "lrcorner\0" "lrhar\0" "lrhard\0" "lrm\0" "lrtri\0" "lsaquo\0"
+    "lscr\0" "lsh\0" "lsim\0" "lsime\0" "lsimg\0" "lsqb\0" "lsquo\0" "lsquor\0" "lstrok\0" "lt\0"
+    "ltcc\0" "ltcir\0" "ltdot\0" "lthree\0" "ltimes\0" "ltlarr\0" "ltquest\0" "ltrPar\0" "ltri\0"
+    "ltrie\0" "ltrif\0" "lurdshar\0" "luruhar\0" "lvertneqq\0" "lvnE\0" "mDDot\0" "macr\0" "male\0"
+    "malt\0" "maltese\0" "map\0" "mapsto\0" "mapstodown\0" "mapstoleft\0" "mapstoup\0" "marker\0"
+    "mcomma\0" "mcy\0" "mdash\0" "measuredangle\0" "mfr\0" "mho\0" "micro\0" "mid\0" "midast\0"
+    "midcir\0" "middot\0" "minus\0" "minusb\0" "minusd\0" "minusdu\0" "mlcp\0" "mldr\0" "mnplus\0"
+    "models\0" "mopf\0" "mp\0" "mscr\0" "mstpos\0" "mu\0" "multimap\0" "mumap\0" "nGg\0" "nGt\0"
+    "nGtv\0" "nLeftarrow\0" "nLeftrightarrow\0" "nLl\0" "nLt\0" "nLtv\0" "nRightarrow\0" "nVDash\0"
+    "nVdash\0" "nabla\0" "nacute\0" "nang\0" "nap\0" "napE\0" "napid\0" "napos\0" "napprox\0"
+    "natur\0" "natural\0" "naturals\0" "nbsp\0" "nbump\0" "nbumpe\0" "ncap\0" "ncaron\0" "ncedil\0"
+    "ncong\0" "ncongdot\0" "ncup\0" "ncy\0" "ndash\0" "ne\0" "neArr\0" "nearhk\0" "nearr\0"
+    "nearrow\0" "nedot\0" "nequiv\0" "nesear\0" "nesim\0" "nexist\0" "nexists\0" "nfr\0" "ngE\0"
+    "nge\0" "ngeq\0" "ngeqq\0" "ngeqslant\0" "nges\0" "ngsim\0" "ngt\0" "ngtr\0" "nhArr\0" "nharr\0"
+    "nhpar\0" "ni\0" "nis\0" "nisd\0" "niv\0" "njcy\0" "nlArr\0" "nlE\0" "nlarr\0" "nldr\0" "nle\0"
+    "nleftarrow\0" "nleftrightarrow\0" "nleq\0" "nleqq\0" "nleqslant\0" "nles\0" "nless\0" "nlsim\0"
+    "nlt\0" "nltri\0" "nltrie\0" "nmid\0" "nopf\0" "not\0" "notin\0" "notinE\0" "notindot\0"
+    "notinva\0" "notinvb\0" "notinvc\0" "notni\0" "notniva\0" "notnivb\0" "notnivc\0" "npar\0"
+    "nparallel\0" "nparsl\0" "npart\0" "npolint\0" "npr\0" "nprcue\0" "npre\0" "nprec\0" "npreceq\0"
+    "nrArr\0" "nrarr\0" "nrarrc\0" "nrarrw\0" "nrightarrow\0" "nrtri\0" "nrtrie\0" "nsc\0"
+    "nsccue\0" "nsce\0" "nscr\0" "nshortmid\0" "nshortparallel\0" "nsim\0" "nsime\0" "nsimeq\0"
+    "nsmid\0" "nspar\0" "nsqsube\0" "nsqsupe\0" "nsub\0" "nsubE\0" "nsube\0" "nsubset\0"
+    "nsubseteq\0" "nsubseteqq\0" "nsucc\0" "nsucceq\0" "nsup\0" "nsupE\0" "nsupe\0" "nsupset\0"
+    "nsupseteq\0" "nsupseteqq\0" "ntgl\0" "ntilde\0" "ntlg\0" "ntriangleleft\0" "ntrianglelefteq\0"
+    "ntriangleright\0" "ntrianglerighteq\0" "nu\0" "num\0" "numero\0" "numsp\0" "nvDash\0"
+    "nvHarr\0" "nvap\0" "nvdash\0" "nvge\0" "nvgt\0" "nvinfin\0" "nvlArr\0" "nvle\0" "nvlt\0"
+    "nvltrie\0" "nvrArr\0" "nvrtrie\0" "nvsim\0" "nwArr\0" "nwarhk\0" "nwarr\0" "nwarrow\0"
+    "nwnear\0" "oS\0" "oacute\0" "oast\0" "ocir\0" "ocirc\0" "ocy\0" "odash\0" "odblac\0" "odiv\0"
+    "odot\0" "odsold\0" "oelig\0" "ofcir\0" "ofr\0" "ogon\0" "ograve\0" "ogt\0" "ohbar\0" "ohm\0"
+    "oint\0" "olarr\0" "olcir\0" "olcross\0" "oline\0" "olt\0" "omacr\0" "omega\0" "omicron\0"
+    "omid\0" "ominus\0" "oopf\0" "opar\0" "operp\0" "oplus\0" "or\0" "orarr\0" "ord\0" "order\0"
+    "orderof\0" "ordf\0" "ordm\0" "origof\0" "oror\0" "orslope\0" "orv\0" "oscr\0" "oslash\0"
+    "osol\0" "otilde\0" "otimes\0" "otimesas\0" "ouml\0" "ovbar\0" "par\0" "para\0" "parallel\0"
+    "parsim\0" "parsl\0" "part\0" "pcy\0" "percnt\0" "period\0" "permil\0" "perp\0" "pertenk\0"
+    "pfr\0" "phi\0" "phiv\0" "phmmat\0" "phone\0" "pi\0" "pitchfork\0" "piv\0" "planck\0"
+    "planckh\0" "plankv\0" "plus\0" "plusacir\0" "plusb\0" "pluscir\0" "plusdo\0" "plusdu\0"
+    "pluse\0" "plusmn\0" "plussim\0" "plustwo\0" "pm\0" "pointint\0" "popf\0" "pound\0" "pr\0"
+    "prE\0" "prap\0" "prcue\0" "pre\0" "prec\0" "precapprox\0" "preccurlyeq\0" "preceq\0"
+    "precnapprox\0" "precneqq\0" "precnsim\0" "precsim\0" "prime\0" "primes\0" "prnE\0" "prnap\0"
+    "prnsim\0" "prod\0" "profalar\0" "profline\0" "profsurf\0" "prop\0" "propto\0" "prsim\0"
+    "prurel\0" "pscr\0" "psi\0" "puncsp\0" "qfr\0" "qint\0" "qopf\0" "qprime\0" "qscr\0"
+    "quaternions\0" "quatint\0" "quest\0" "questeq\0" "quot\0" "rAarr\0" "rArr\0" "rAtail\0"
+    "rBarr\0" "rHar\0" "race\0" "racute\0" "radic\0" "raemptyv\0" "rang\0" "rangd\0" "range\0"
+    "rangle\0" "raquo\0" "rarr\0" "rarrap\0" "rarrb\0" "rarrbfs\0" "rarrc\0" "rarrfs\0" "rarrhk\0"
+    "rarrlp\0" "rarrpl\0" "rarrsim\0" "rarrtl\0" "rarrw\0" "ratail\0" "ratio\0" "rationals\0"
+    "rbarr\0" "rbbrk\0" "rbrace\0" "rbrack\0" "rbrke\0" "rbrksld\0" "rbrkslu\0" "rcaron\0"
+    "rcedil\0" "rceil\0" "rcub\0" "rcy\0" "rdca\0" "rdldhar\0" "rdquo\0" "rdquor\0" "rdsh\0"
+    "real\0" "realine\0" "realpart\0" "reals\0" "rect\0" "reg\0" "rfisht\0" "rfloor\0" "rfr\0"
+    "rhard\0" "rharu\0" "rharul\0" "rho\0" "rhov\0" "rightarrow\0" "rightarrowtail\0"
+    "rightharpoondown\0" "rightharpoonup\0" "rightleftarrows\0" "rightleftharpoons\0"
+    "rightrightarrows\0" "rightsquigarrow\0" "rightthreetimes\0" "ring\0" "risingdotseq\0" "rlarr\0"
+    "rlhar\0" "rlm\0" "rmoust\0" "rmoustache\0" "rnmid\0" "roang\0" "roarr\0" "robrk\0" "ropar\0"
+    "ropf\0" "roplus\0" "rotimes\0" "rpar\0" "rpargt\0" "rppolint\0" "rrarr\0" "rsaquo\0" "rscr\0"
+    "rsh\0" "rsqb\0" "rsquo\0" "rsquor\0" "rthree\0" "rtimes\0" "rtri\0" "rtrie\0" "rtrif\0"
+    "rtriltri\0" "ruluhar\0" "rx\0" "sacute\0" "sbquo\0" "sc\0" "scE\0" "scap\0" "scaron\0"
+    "sccue\0" "sce\0" "scedil\0" "scirc\0" "scnE\0" "scnap\0" "scnsim\0" "scpolint\0" "scsim\0"
+    "scy\0" "sdot\0" "sdotb\0" "sdote\0" "seArr\0" "searhk\0" "searr\0" "searrow\0" "sect\0"
+    "semi\0" "seswar\0" "setminus\0" "setmn\0" "sext\0" "sfr\0" "sfrown\0" "sharp\0" "shchcy\0"
+    "shcy\0" "shortmid\0" "shortparallel\0" "shy\0" "sigma\0" "sigmaf\0" "sigmav\0" "sim\0"
+    "simdot\0" "sime\0" "simeq\0" "simg\0" "simgE\0" "siml\0" "simlE\0" "simne\0" "simplus\0"
+    "simrarr\0" "slarr\0" "smallsetminus\0" "smashp\0" "smeparsl\0" "smid\0" "smile\0" "smt\0"
+    "smte\0" "smtes\0" "softcy\0" "sol\0" "solb\0" "solbar\0" "sopf\0" "spades\0" "spadesuit\0"
+    "spar\0" "sqcap\0" "sqcaps\0" "sqcup\0" "sqcups\0" "sqsub\0" "sqsube\0" "sqsubset\0"
+    "sqsubseteq\0" "sqsup\0" "sqsupe\0" "sqsupset\0" "sqsupseteq\0" "squ\0" "square\0" "squarf\0"
+    "squf\0" "srarr\0" "sscr\0" "ssetmn\0" "ssmile\0" "sstarf\0" "star\0" "starf\0"
+    "straightepsilon\0" "straightphi\0" "strns\0" "sub\0" "subE\0" "subdot\0" "sube\0" "subedot\0"
+    "submult\0" "subnE\0" "subne\0" "subplus\0" "subrarr\0" "subset\0" "subseteq\0" "subseteqq\0"
+    "subsetneq\0" "subsetneqq\0" "subsim\0" "subsub\0" "subsup\0" "succ\0" "succapprox\0"
+    "succcurlyeq\0" "succeq\0" "succnapprox\0" "succneqq\0" "succnsim\0" "succsim\0" "sum\0"
+    "sung\0" "sup\0" "sup1\0" "sup2\0" "sup3\0" "supE\0" "supdot\0" "supdsub\0" "supe\0" "supedot\0"
+    "suphsol\0" "suphsub\0" "suplarr\0" "supmult\0" "supnE\0" "supne\0" "supplus\0" "supset\0"
+    "supseteq\0" "supseteqq\0" "supsetneq\0" "supsetneqq\0" "supsim\0" "supsub\0" "supsup\0"
+    "swArr\0" "swarhk\0" "swarr\0" "swarrow\0" "swnwar\0" "szlig\0" "target\0" "tau\0" "tbrk\0"
+    "tcaron\0" "tcedil\0" "tcy\0" "tdot\0" "telrec\0" "tfr\0" "there4\0" "therefore\0" "theta\0"
+    "thetasym\0" "thetav\0" "thickapprox\0" "thicksim\0" "thinsp\0" "thkap\0" "thksim\0" "thorn\0"
+    "tilde\0" "times\0" "timesb\0" "timesbar\0" "timesd\0" "tint\0" "toea\0" "top\0" "topbot\0"
+    "topcir\0" "topf\0" "topfork\0" "tosa\0" "tprime\0" "trade\0" "triangle\0" "triangledown\0"
+    "triangleleft\0" "trianglelefteq\0" "triangleq\0" "triangleright\0" "trianglerighteq\0"
+    "tridot\0" "trie\0" "triminus\0" "triplus\0" "trisb\0" "tritime\0" "trpezium\0" "tscr\0"
+    "tscy\0" "tshcy\0" "tstrok\0" "twixt\0" "twoheadleftarrow\0" "twoheadrightarrow\0" "uArr\0"
+    "uHar\0" "uacute\0" "uarr\0" "ubrcy\0" "ubreve\0" "ucirc\0" "ucy\0" "udarr\0" "udblac\0"
+    "udhar\0" "ufisht\0" "ufr\0" "ugrave\0" "uharl\0" "uharr\0" "uhblk\0" "ulcorn\0" "ulcorner\0"
+    "ulcrop\0" "ultri\0" "umacr\0" "uml\0" "uogon\0" "uopf\0" "uparrow\0" "updownarrow\0"
+    "upharpoonleft\0" "upharpoonright\0" "uplus\0" "upsi\0" "upsih\0" "upsilon\0" "upuparrows\0"
+    "urcorn\0" "urcorner\0" "urcrop\0" "uring\0" "urtri\0" "uscr\0" "utdot\0" "utilde\0" "utri\0"
+    "utrif\0" "uuarr\0" "uuml\0" "uwangle\0" "vArr\0" "vBar\0" "vBarv\0" "vDash\0" "vangrt\0"
+    "varepsilon\0" "varkappa\0" "varnothing\0" "varphi\0" "varpi\0" "varpropto\0" "varr\0"
+    "varrho\0" "varsigma\0" "varsubsetneq\0" "varsubsetneqq\0" "varsupsetneq\0" "varsupsetneqq\0"
+    "vartheta\0" "vartriangleleft\0" "vartriangleright\0" "vcy\0" "vdash\0" "vee\0" "veebar\0"
+    "veeeq\0" "vellip\0" "verbar\0" "vert\0" "vfr\0" "vltri\0" "vnsub\0" "vnsup\0" "vopf\0"
+    "vprop\0" "vrtri\0" "vscr\0" "vsubnE\0" "vsubne\0" "vsupnE\0" "vsupne\0" "vzigzag\0" "wcirc\0"
+    "wedbar\0" "wedge\0" "wedgeq\0" "weierp\0" "wfr\0" "wopf\0" "wp\0" "wr\0" "wreath\0" "wscr\0"
+    "xcap\0" "xcirc\0" "xcup\0" "xdtri\0" "xfr\0" "xhArr\0" "xharr\0" "xi\0" "xlArr\0" "xlarr\0"
+    "xmap\0" "xnis\0" "xodot\0" "xopf\0" "xoplus\0" "xotime\0" "xrArr\0" "xrarr\0" "xscr\0"
+    "xsqcup\0" "xuplus\0" "xutri\0" "xvee\0" "xwedge\0" "yacute\0" "yacy\0" "ycirc\0" "ycy\0"
+    "yen\0" "yfr\0" "yicy\0" "yopf\0" "yscr\0" "yucy\0" "yuml\0" "zacute\0" "zcaron\0" "zcy\0"
+    "zdot\0" "zeetrf\0" "zeta\0" "zfr\0" "zhcy\0" "zigrarr\0" "zopf\0" "zscr\0" "zwj\0" "zwnj\0";
+
+static const uint8_t HTML_ENTITY_SEEDS[HTML_ENTITY_BUCKET_COUNT] = {
+    2, 1, 3, 1, 1, 1, 2, 1, 1, 2, 1, 4, 1, 1, 0, 2,
+    3, 1, 1, 2, 4, 1, 2, 1, 2, 5, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 3, 1, 2, 2, 3, 1, 1, 1, 2, 2, 2, 1, 1,
+    1, 3, 3, 2, 1, 1, 20, 2, 1, 1, 1, 3, 1, 4, 1, 2,
+    2, 2, 0, 1, 1, 2, 6, 1, 6, 1, 2, 2, 1, 2, 0, 7,
+    1, 2, 0, 4, 1, 1, 1, 1, 1, 1, 0, 2, 1, 5, 1, 1,
+    4, 1, 0, 2, 1, 1, 1, 1, 1, 2, 1, 1, 3, 2, 0, 2,
+    1, 0, 4, 3, 0, 1, 0, 1, 1, 1, 0, 1, 2, 1, 1, 5,
+    1, 6, 2, 1, 1, 1, 1, 3, 1, 3, 1, 1, 1, 1, 1, 2,
+    11, 1, 1, 1, 4, 1, 2, 2, 6, 0, 1, 1, 2, 1, 4, 1,
+    2, 1, 1, 1, 3, 9, 2, 1, 4, 1, 2, 1, 6, 3, 1, 0,
+    5, 3, 2, 4, 0, 3, 1, 1, 2, 3, 1, 13, 1, 1, 1, 1,
+    1, 3, 1, 64, 1, 1, 0, 1, 1, 0, 2, 3, 1, 0, 10, 3,
+    1, 1, 2, 2, 0, 3, 1, 1, 0, 1, 0, 2, 2, 2, 1, 1,
+    1, 1, 4, 1, 5, 6, 1, 1, 3, 0, 4, 1, 4, 1, 66, 2,
+    2, 2, 1, 1, 1, 3, 0, 2, 2, 2, 2, 15, 5, 1, 0, 1,
+    4, 4, 2, 1, 4, 1, 1, 1, 6, 1, 2, 2, 2, 3, 9, 4,
+    1, 64, 2, 1, 64, 3, 1, 1, 0, 22, 4, 0, 1, 4, 3, 8,
+    1, 2, 1, 1, 0, 2, 1, 3, 2, 2, 3, 1, 3, 5, 0, 4,
+    1, 2, 1, 3, 0, 1, 1, 1, 2, 1, 1, 1, 1, 14, 0, 3,
+    0, 1, 5, 2, 1, 1, 1, 1, 1, 30, 1, 1, 19, 1, 1, 27,
+    1, 1, 2, 1, 1, 2, 4, 3, 65, 5, 1, 3, 2, 40, 1, 1,
+    3, 1, 2, 0, 0, 3, 0, 0, 3, 64, 0, 1, 3, 1, 1, 1,
+    2, 2, 0, 6, 3, 2, 4, 2, 3, 1, 2, 0, 12, 1, 0, 0,
+    5, 4, 2, 17, 1, 1, 1, 1, 3, 3, 1, 1, 0, 1, 1, 1,
+    24, 1, 5, 5, 1, 2, 2, 1, 1, 66, 6, 3, 0, 0, 1, 0,
+    0, 1, 2, 1, 0, 4, 1, 2, 64, 1, 1, 2, 1, 3, 1, 2,
+    1, 2, 0, 1, 6, 5, 2, 1, 1, 3, 65, 1, 1, 2, 1, 7,
+    2, 2, 1, 0, 1, 1, 0, 7, 1, 1, 21, 1, 1, 0, 1, 1,
+    1, 13, 1, 30, 1, 0, 0, 1, 2, 2, 1, 0, 3, 1, 1, 2,
+    0, 0, 1, 2, 7, 3, 3, 1, 2, 1, 4, 1, 3, 0, 0, 1,
+    1, 1, 0, 1, 1, 1, 1, 3, 14, 7, 1, 0, 0, 0, 5, 2,
+    3, 0, 2, 4, 5, 3, 1, 1, 12, 1, 2, 6, 1, 2, 4, 1,
+    1, 0, 3, 4, 1, 1, 2, 1, 15, 1, 1, 1, 2, 0, 0, 1,
+    7, 19, 1, 2, 3, 8, 1, 7, 18, 1, 1, 1, 0, 3, 3, 1,
+    0, 2, 6, 2, 6, 1, 5, 1, 1, 1, 1, 1, 1, 3, 0, 2,
+    68, 2, 1, 2, 1, 1, 1, 0, 2, 2, 0, 1, 21, 0, 2, 1,
+    1, 1, 2, 9, 0, 0, 1, 2, 1, 1, 4, 3, 7, 0, 2, 1,
+    3, 6, 3, 4, 6, 1, 2, 2, 1, 2, 2, 1, 3, 71, 0, 0,
+    1, 0, 2, 1, 4, 5, 5, 1, 3, 2, 1, 0, 2, 0, 22, 13,
+    1, 1, 2, 26, 17, 1, 1, 3, 3, 2, 0, 13, 3, 1, 0, 1,
+    1, 2, 2, 2, 1, 10, 65, 1, 2, 4, 1, 1, 1, 0, 2, 2,
+    2, 0, 1, 2, 3, 62, 9, 4, 1, 1, 1, 2, 3, 0, 2, 1,
+    2, 2, 1, 1, 1, 1, 1, 5, 3, 20, 7, 1, 0, 0, 2, 2,
+    3, 1, 1, 1, 1, 0, 2, 1, 1, 1, 2, 0, 6, 42, 3, 1,
+    8, 2, 1, 0, 9, 1, 1, 1, 2, 0, 1, 1, 3, 0, 4, 15,
+    0, 5, 2, 8, 0, 0, 6, 1, 1, 64, 1, 4, 6, 2, 1, 3,
+    65, 2, 64, 1, 7, 1, 4, 1, 1, 5, 13, 2, 1, 0, 1, 0,
+    1, 0, 1, 4, 4, 0, 1, 5, 1, 5, 1, 9, 12, 2, 6, 2,
+    65, 1, 2, 1, 15, 1, 1, 2, 7, 5, 18, 1, 1, 1, 68, 3,
+    5, 0, 1, 1, 1, 20, 1, 3, 4, 1, 1, 11, 1, 2, 1, 2,
+    1, 1, 3, 1, 4, 0, 1, 65, 0, 4, 22, 3, 3, 68, 2, 2,
+    6, 12, 1, 1, 9, 1, 7, 3, 1, 20, 4, 4, 10, 64, 9, 1,
+    1, 0, 0, 4, 2, 2, 0, 7, 1, 1, 7, 3, 5, 1, 2, 2,
+    2, 0, 4, 70, 0, 0, 2, 1, 14, 8, 2, 1, 2, 4, 2, 1,
+    2, 1, 3, 1, 2, 2, 27, 1, 1, 1, 3, 1, 6, 2, 35, 2,
+    0, 0, 3, 1, 0, 2, 1, 2, 1, 1, 1, 64, 1, 1, 64, 2,
+    2, 1, 3, 0, 4, 8, 10, 0, 5, 65, 2, 0, 15, 20, 2, 1,
+    7, 9, 2, 4, 1, 7, 5, 16, 6, 4, 18, 1, 2, 1, 11, 1,
+    1, 3, 2, 1, 2, 2, 21, 1, 2, 0, 9, 1, 1, 1, 1, 0,
+    2, 0, 1, 1, 0, 0, 2, 65, 1, 1, 1, 0, 5, 4, 1, 0,
+    4, 2, 1, 4, 3, 0, 5, 1, 3, 3, 3, 21, 7, 9, 4, 3,
+    0, 2, 29, 42, 15, 3, 1, 2, 1, 2, 1, 1, 1, 12, 3, 3,
+    0, 1, 1, 64, 1, 4, 3, 0, 2, 0, 1, 1, 6, 0, 1, 2,
+};
+
+static const uint16_t HTML_ENTITY_SLOTS[HTML_ENTITY_SLOT_COUNT] = {
+    HTML_ENTITY_EMPTY_SLOT, 12313, 10548, 5319, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15472, HTML_ENTITY_EMPTY_SLOT, 10478, HTML_ENTITY_EMPTY_SLOT, 11070,
+    HTML_ENTITY_EMPTY_SLOT, 1315, HTML_ENTITY_EMPTY_SLOT, 8623, 8924, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    12494, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13466, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 14849, HTML_ENTITY_EMPTY_SLOT,
+    15301, 6317, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7232, 456, HTML_ENTITY_EMPTY_SLOT, 7375, HTML_ENTITY_EMPTY_SLOT, 1979, HTML_ENTITY_EMPTY_SLOT, 8153,
+    142, HTML_ENTITY_EMPTY_SLOT, 585, 7663, 14155, 181, 8226, 9981, 15947, 6751, 4171, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 15067, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6034, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10533, HTML_ENTITY_EMPTY_SLOT, 13768,
+    13024, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7635, 13500, 5390, 12775, 3559, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    11875, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6222, HTML_ENTITY_EMPTY_SLOT, 10680, HTML_ENTITY_EMPTY_SLOT, 5488, 13242, 3741, 13687, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 9942, 1740, 12027, HTML_ENTITY_EMPTY_SLOT, 5661, HTML_ENTITY_EMPTY_SLOT, 6956, 2908, 9790, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13795, 10073, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6376, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9132, 8776, 7906,
+    HTML_ENTITY_EMPTY_SLOT, 3764, 15250, 7010, 7405, 4976, 13973, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 2995,
+    1504, 5819, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12318, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9917,
+    10284, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13718, 7687, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8458, HTML_ENTITY_EMPTY_SLOT, 9818, 7887, 2532,
+    4078, 15233, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 913, HTML_ENTITY_EMPTY_SLOT, 9715, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13211, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5460, 12187, HTML_ENTITY_EMPTY_SLOT, 10877, 2022, 8721, 14610, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 7416, HTML_ENTITY_EMPTY_SLOT, 9539, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 4641, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11184,
+    7724, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 14726, HTML_ENTITY_EMPTY_SLOT, 9999, HTML_ENTITY_EMPTY_SLOT, 12056, HTML_ENTITY_EMPTY_SLOT,
+    4903, HTML_ENTITY_EMPTY_SLOT, 10273, 4021, 7345, HTML_ENTITY_EMPTY_SLOT, 6495, 7146, HTML_ENTITY_EMPTY_SLOT, 779, HTML_ENTITY_EMPTY_SLOT, 11628,
+    HTML_ENTITY_EMPTY_SLOT, 12348, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 2566, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1237, 14460, 9138, 15220, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 15098, HTML_ENTITY_EMPTY_SLOT, 5578, HTML_ENTITY_EMPTY_SLOT, 61, 5024, HTML_ENTITY_EMPTY_SLOT, 9427, 10297, HTML_ENTITY_EMPTY_SLOT, 4648,
+    14836, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8740, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8253, 15046, 11030, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    1661, 14938, HTML_ENTITY_EMPTY_SLOT, 12525, HTML_ENTITY_EMPTY_SLOT, 13042, HTML_ENTITY_EMPTY_SLOT, 3052, 1631, 16003, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    650, 6584, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8099, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15888, 2871, 11038, HTML_ENTITY_EMPTY_SLOT, 8396,
+    1938, HTML_ENTITY_EMPTY_SLOT, 6288, 1275, HTML_ENTITY_EMPTY_SLOT, 2036, 15919, 5206, HTML_ENTITY_EMPTY_SLOT, 11521, HTML_ENTITY_EMPTY_SLOT, 9901,
+    HTML_ENTITY_EMPTY_SLOT, 11246, 6171, 1613, 7334, 11162, HTML_ENTITY_EMPTY_SLOT, 15904, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15784,
+    14911, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9351, 7613, 6252, HTML_ENTITY_EMPTY_SLOT, 1363, 6853, 11983, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13160, 5877, HTML_ENTITY_EMPTY_SLOT, 12674, 2972, HTML_ENTITY_EMPTY_SLOT, 6806, 12606, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12408, 3754, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 14364, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 4629,
+    16120, 1626, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15839, HTML_ENTITY_EMPTY_SLOT, 11658, 13230, 8533, HTML_ENTITY_EMPTY_SLOT, 9697,
+    9460, HTML_ENTITY_EMPTY_SLOT, 6181, 8139, 15121, 5075, 6924, HTML_ENTITY_EMPTY_SLOT, 8793, 14188, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 2551, 7711, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9244, 8603, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    12944, HTML_ENTITY_EMPTY_SLOT, 9775, 10623, 16025, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8025, HTML_ENTITY_EMPTY_SLOT, 10239, HTML_ENTITY_EMPTY_SLOT, 6661,
+    8869, 11404, 1729, HTML_ENTITY_EMPTY_SLOT, 14418, HTML_ENTITY_EMPTY_SLOT, 5425, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1694, 9832, 15568,
+    HTML_ENTITY_EMPTY_SLOT, 7703, 11826, 6045, HTML_ENTITY_EMPTY_SLOT, 394, HTML_ENTITY_EMPTY_SLOT, 2130, 15991, HTML_ENTITY_EMPTY_SLOT, 10728, 10636,
+    5284, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11933, 12698, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7220,
+    HTML_ENTITY_EMPTY_SLOT, 12939, HTML_ENTITY_EMPTY_SLOT, 11530, 2614, HTML_ENTITY_EMPTY_SLOT, 4545, 9093, 3947, HTML_ENTITY_EMPTY_SLOT, 15748, 6574,
+    10612, 12767, 13789, 5144, 8297, HTML_ENTITY_EMPTY_SLOT, 528, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9166, 15197,
+    1252, 13111, HTML_ENTITY_EMPTY_SLOT, 6774, HTML_ENTITY_EMPTY_SLOT, 13237, 12242, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11880, HTML_ENTITY_EMPTY_SLOT, 9013,
+    9156, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9702, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10863, 4368, HTML_ENTITY_EMPTY_SLOT, 13821, HTML_ENTITY_EMPTY_SLOT, 11236,
+    11861, 2913, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5844, HTML_ENTITY_EMPTY_SLOT, 6236, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9229,
+    HTML_ENTITY_EMPTY_SLOT, 14776, 3828, HTML_ENTITY_EMPTY_SLOT, 1443, HTML_ENTITY_EMPTY_SLOT, 6227, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8171,
+    HTML_ENTITY_EMPTY_SLOT, 5981, 15714, 14890, 14514, HTML_ENTITY_EMPTY_SLOT, 2634, HTML_ENTITY_EMPTY_SLOT, 11684, 4211, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    13069, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10926, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12367, HTML_ENTITY_EMPTY_SLOT, 302, 13098, HTML_ENTITY_EMPTY_SLOT, 13542,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5712, 3273, 4725, 11716, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7916, HTML_ENTITY_EMPTY_SLOT, 8087, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5862, 4838, HTML_ENTITY_EMPTY_SLOT, 10181, 1307, 13189, 10721, 10107, 11321, 13275,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 433, 5379, HTML_ENTITY_EMPTY_SLOT, 3286, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    15971, 7174, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12985, HTML_ENTITY_EMPTY_SLOT, 2813, HTML_ENTITY_EMPTY_SLOT, 14051, 11302, 6566, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13589, HTML_ENTITY_EMPTY_SLOT, 4417, 4049, 13368, HTML_ENTITY_EMPTY_SLOT, 11968, 7731, HTML_ENTITY_EMPTY_SLOT, 14210,
+    7778, HTML_ENTITY_EMPTY_SLOT, 1911, 11255, 10813, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 14760, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    15167, 1001, 692, 6145, 16124, HTML_ENTITY_EMPTY_SLOT, 4388, 5823, 3472, 14107, 4823, HTML_ENTITY_EMPTY_SLOT,
+    12362, 257, 11793, 12560, 14328, 9261, 8894, 1516, 10707, 14978, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9743, 15058, HTML_ENTITY_EMPTY_SLOT, 16043, HTML_ENTITY_EMPTY_SLOT, 8614, 5896, 14598, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    2891, HTML_ENTITY_EMPTY_SLOT, 6626, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6130, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15426, HTML_ENTITY_EMPTY_SLOT, 14686, 1745,
+    7491, 5678, HTML_ENTITY_EMPTY_SLOT, 11672, 11296, 14172, HTML_ENTITY_EMPTY_SLOT, 706, HTML_ENTITY_EMPTY_SLOT, 3122, 715, HTML_ENTITY_EMPTY_SLOT,
+    5776, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10787, 15929, 5769, 10155, 9566, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 14233, 92, 3738, 12372, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 2518, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9320,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 4091, 13484, 14644, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11127, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13870, HTML_ENTITY_EMPTY_SLOT,
+    13808, HTML_ENTITY_EMPTY_SLOT, 7745, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 67, HTML_ENTITY_EMPTY_SLOT, 15854, HTML_ENTITY_EMPTY_SLOT, 214, 14488,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9785, HTML_ENTITY_EMPTY_SLOT, 3228, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15226, 12781, 5786,
+    8898, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12955, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10089, 12905, 3907, 13471,
+    3639, 6306, HTML_ENTITY_EMPTY_SLOT, 14518, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15144, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12702, 11282,
+    HTML_ENTITY_EMPTY_SLOT, 13303, 7294, HTML_ENTITY_EMPTY_SLOT, 12306, HTML_ENTITY_EMPTY_SLOT, 12110, 13915, 7894, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7843,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1706, 12991, HTML_ENTITY_EMPTY_SLOT, 13729, HTML_ENTITY_EMPTY_SLOT, 12487, HTML_ENTITY_EMPTY_SLOT, 8522, 10973,
+    15461, HTML_ENTITY_EMPTY_SLOT, 13000, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12192, 9400, 2029, 3243,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11024, HTML_ENTITY_EMPTY_SLOT, 14199, HTML_ENTITY_EMPTY_SLOT, 1473, HTML_ENTITY_EMPTY_SLOT, 1961, HTML_ENTITY_EMPTY_SLOT,
+    1354, 15966, HTML_ENTITY_EMPTY_SLOT, 6199, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13735, HTML_ENTITY_EMPTY_SLOT, 15103, 10673, 612,
+    12216, HTML_ENTITY_EMPTY_SLOT, 11115, 12071, HTML_ENTITY_EMPTY_SLOT, 9924, 13951, 1099, 5033, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12657,
+    12917, HTML_ENTITY_EMPTY_SLOT, 15913, 564, HTML_ENTITY_EMPTY_SLOT, 15848, 5173, HTML_ENTITY_EMPTY_SLOT, 11425, 8081, HTML_ENTITY_EMPTY_SLOT, 3877,
+    13772, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 2856, 4107, 15480, 7047, 11148, 2703, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    6933, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5037, 1943, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1184, 8247, HTML_ENTITY_EMPTY_SLOT, 1896,
+    8034, HTML_ENTITY_EMPTY_SLOT, 7992, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11170, 6824, 12968, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7028,
+    HTML_ENTITY_EMPTY_SLOT, 5187, 9268, 5193, 7521, 7807, HTML_ENTITY_EMPTY_SLOT, 11355, 12856, HTML_ENTITY_EMPTY_SLOT, 4153, 6451,
+    12586, 8765, HTML_ENTITY_EMPTY_SLOT, 14046, 263, 14179, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7794, 15162, 12513,
+    13882, 8886, 13753, 7591, HTML_ENTITY_EMPTY_SLOT, 198, HTML_ENTITY_EMPTY_SLOT, 5139, HTML_ENTITY_EMPTY_SLOT, 11921, 10743, 8966,
+    HTML_ENTITY_EMPTY_SLOT, 12669, HTML_ENTITY_EMPTY_SLOT, 14902, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 942, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 12579, 5870, HTML_ENTITY_EMPTY_SLOT, 10695, 3005, 4156, 15791, HTML_ENTITY_EMPTY_SLOT, 9047, HTML_ENTITY_EMPTY_SLOT, 9406,
+    5790, 10250, 763, 2459, 6513, 12129, 9249, 11653, HTML_ENTITY_EMPTY_SLOT, 3843, HTML_ENTITY_EMPTY_SLOT, 15190,
+    12396, 1878, HTML_ENTITY_EMPTY_SLOT, 9289, HTML_ENTITY_EMPTY_SLOT, 6818, HTML_ENTITY_EMPTY_SLOT, 8848, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 3357, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 3726, 1296, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5055, HTML_ENTITY_EMPTY_SLOT, 4968, 12962,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1387, 1994, HTML_ENTITY_EMPTY_SLOT, 5707, 6267, 10641, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5918, 9722, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11074, HTML_ENTITY_EMPTY_SLOT, 14509, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 4679,
+    6359, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13320, 7079, 11536, HTML_ENTITY_EMPTY_SLOT, 7641, 9881, 14720, HTML_ENTITY_EMPTY_SLOT, 15361,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1920, 1974, 9946, 8070, HTML_ENTITY_EMPTY_SLOT, 14240, HTML_ENTITY_EMPTY_SLOT, 12420, HTML_ENTITY_EMPTY_SLOT, 15467,
+    14299, 2286, 16058, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12925, 12973, HTML_ENTITY_EMPTY_SLOT, 14467, HTML_ENTITY_EMPTY_SLOT, 5656, 6438,
+    10854, HTML_ENTITY_EMPTY_SLOT, 11892, 5755, 14057, 9559, HTML_ENTITY_EMPTY_SLOT, 7650, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    8608, 12683, HTML_ENTITY_EMPTY_SLOT, 15684, 5059, 15114, HTML_ENTITY_EMPTY_SLOT, 15825, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 14765, 14991,
+    HTML_ENTITY_EMPTY_SLOT, 8303, 11664, HTML_ENTITY_EMPTY_SLOT, 13450, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7288, HTML_ENTITY_EMPTY_SLOT, 10606, HTML_ENTITY_EMPTY_SLOT, 12628,
+    HTML_ENTITY_EMPTY_SLOT, 15898, HTML_ENTITY_EMPTY_SLOT, 9030, 2677, HTML_ENTITY_EMPTY_SLOT, 8992, 13929, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    3588, 8112, 14437, 7368, 11832, 11886, HTML_ENTITY_EMPTY_SLOT, 11487, 6063, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5900,
+    11276, 8360, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7098, 6004, 9328, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    11590, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 4402, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 14259, HTML_ENTITY_EMPTY_SLOT, 14827, HTML_ENTITY_EMPTY_SLOT, 9851, HTML_ENTITY_EMPTY_SLOT,
+    11142, 5051, 13090, 9215, 440, HTML_ENTITY_EMPTY_SLOT, 14558, 5498, 6298, 12159, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6325, HTML_ENTITY_EMPTY_SLOT, 15285, 2270, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6368, 2655,
+    7093, 9888, 6637, 7427, HTML_ENTITY_EMPTY_SLOT, 7273, 8686, 13802, 12758, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    6913, HTML_ENTITY_EMPTY_SLOT, 8637, 11102, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5492, 2337, HTML_ENTITY_EMPTY_SLOT, 243, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 51, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5697, HTML_ENTITY_EMPTY_SLOT, 2666, HTML_ENTITY_EMPTY_SLOT,
+    10821, HTML_ENTITY_EMPTY_SLOT, 6080, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5692, HTML_ENTITY_EMPTY_SLOT, 3255, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    525, 10146, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15877, 12451, 7819, 13134, 12170, 15812, HTML_ENTITY_EMPTY_SLOT, 5398,
+    HTML_ENTITY_EMPTY_SLOT, 13336, 7739, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13140, 15575, 15443, 10997, 711, 4651,
+    HTML_ENTITY_EMPTY_SLOT, 9511, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12621, 10760, HTML_ENTITY_EMPTY_SLOT, 10381, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1810, 5666,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12401, 15832, 7355, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7133, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 15089, 15759, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13987, 11376, HTML_ENTITY_EMPTY_SLOT, 5086, HTML_ENTITY_EMPTY_SLOT, 8563,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 547, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1932, 14348, HTML_ENTITY_EMPTY_SLOT, 12893, 11434, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 126, HTML_ENTITY_EMPTY_SLOT, 6392, HTML_ENTITY_EMPTY_SLOT, 131, 8873, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7847, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    14618, 15172, 4448, 4766, HTML_ENTITY_EMPTY_SLOT, 3106, HTML_ENTITY_EMPTY_SLOT, 9757, 9863, 3544, 11268, 15184,
+    6655, HTML_ENTITY_EMPTY_SLOT, 9066, HTML_ENTITY_EMPTY_SLOT, 14015, 12293, HTML_ENTITY_EMPTY_SLOT, 13962, 10013, 10029, HTML_ENTITY_EMPTY_SLOT, 4135,
+    13909, 2879, 8495, 9613, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5159, HTML_ENTITY_EMPTY_SLOT, 11382, 10754, HTML_ENTITY_EMPTY_SLOT, 3138,
+    1771, 10291, 14146, 9005, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8377, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9676,
+    HTML_ENTITY_EMPTY_SLOT, 7085, 10985, 14001, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5516, HTML_ENTITY_EMPTY_SLOT, 8207, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6608,
+    HTML_ENTITY_EMPTY_SLOT, 8164, 1832, HTML_ENTITY_EMPTY_SLOT, 591, HTML_ENTITY_EMPTY_SLOT, 15404, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6206,
+    8748, 4709, 7265, 12271, 5483, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8048, HTML_ENTITY_EMPTY_SLOT, 8313, 2148, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 4282, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15075, HTML_ENTITY_EMPTY_SLOT, 9779, 6020, 8998, HTML_ENTITY_EMPTY_SLOT, 15509, 13255,
+    HTML_ENTITY_EMPTY_SLOT, 15540, 14950, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13083, 4675, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6579, 6679, 7507,
+    13309, HTML_ENTITY_EMPTY_SLOT, 1228, 14654, 9364, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11787, 6907, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11727,
+    6950, HTML_ENTITY_EMPTY_SLOT, 9937, 3885, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5764, HTML_ENTITY_EMPTY_SLOT, 12323, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13325,
+    13693, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10629, 8961, 1954, 7697, 9875, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    11034, 7060, 6, HTML_ENTITY_EMPTY_SLOT, 6213, HTML_ENTITY_EMPTY_SLOT, 7934, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12335, 11262, 4912,
+    HTML_ENTITY_EMPTY_SLOT, 4111, 4744, 9582, HTML_ENTITY_EMPTY_SLOT, 12508, 13174, 9603, 10915, 6847, 15237, 8876,
+    HTML_ENTITY_EMPTY_SLOT, 13383, 15770, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1915, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8752, 7527, 11000, 8214, 6745, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9023, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 9149, 8158, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7034, HTML_ENTITY_EMPTY_SLOT, 10428, 4694,
+    6538, HTML_ENTITY_EMPTY_SLOT, 6159, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 294, 15547, 5465, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12197, 1161,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1969, HTML_ENTITY_EMPTY_SLOT, 1467, 16072, HTML_ENTITY_EMPTY_SLOT, 9088, HTML_ENTITY_EMPTY_SLOT, 10258, 4891, 10507,
+    5505, 14699, 12931, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1868, 11598, 7728, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12872,
+    2350, 15954, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5856, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12550, 5029, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12281,
+    HTML_ENTITY_EMPTY_SLOT, 16015, 9649, 3186, 10843, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1699, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    14217, 581, 4622, 3397, 4248, 3511, 8063, 15397, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    8580, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 2493, 14528, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12868, 161, 9500, 5911,
+    HTML_ENTITY_EMPTY_SLOT, 14139, 15320, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12137, 10324, 7411, 11850, 13490, 15207,
+    4875, 12436, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6720, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    14582, 8557, 13905, HTML_ENTITY_EMPTY_SLOT, 503, 12354, HTML_ENTITY_EMPTY_SLOT, 13434, 10667, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15563,
+    14756, 15798, HTML_ENTITY_EMPTY_SLOT, 6118, HTML_ENTITY_EMPTY_SLOT, 12687, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 16081, HTML_ENTITY_EMPTY_SLOT, 8472, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9478, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6556, 3456, 6259, 34,
+    11710, 9529, 896, HTML_ENTITY_EMPTY_SLOT, 1321, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10395, 12144, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 9931, 8467, HTML_ENTITY_EMPTY_SLOT, 235, HTML_ENTITY_EMPTY_SLOT, 14068, 1583, 7799, 10399, 9691, 203,
+    3944, HTML_ENTITY_EMPTY_SLOT, 16033, HTML_ENTITY_EMPTY_SLOT, 9825, 5816, 5254, HTML_ENTITY_EMPTY_SLOT, 9681, 16065, 9193, 7438,
+    HTML_ENTITY_EMPTY_SLOT, 15851, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6891, HTML_ENTITY_EMPTY_SLOT, 14815, 16053, 11136, HTML_ENTITY_EMPTY_SLOT,
+    6987, 10522, 9411, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 3167, 15584, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1224, HTML_ENTITY_EMPTY_SLOT, 138,
+    9282, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8679, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 3434, 116, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15730, 9335, 9660, HTML_ENTITY_EMPTY_SLOT, 11179, 11900, HTML_ENTITY_EMPTY_SLOT, 8127, 11799,
+    12081, HTML_ENTITY_EMPTY_SLOT, 5613, 14380, 15985, 11503, 3610, 13636, HTML_ENTITY_EMPTY_SLOT, 8274, 13062, 15413,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7880, HTML_ENTITY_EMPTY_SLOT, 960, 13629, 5267, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13146, 12838, HTML_ENTITY_EMPTY_SLOT,
+    9449, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5166, HTML_ENTITY_EMPTY_SLOT, 8891, HTML_ENTITY_EMPTY_SLOT, 10339, 13270, HTML_ENTITY_EMPTY_SLOT,
+    298, 13677, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13648, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11365, 10330, 14293,
+    HTML_ENTITY_EMPTY_SLOT, 15694, 276, 14203, 12950, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8772, HTML_ENTITY_EMPTY_SLOT, 7771, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15742, 12204, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11083, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    10174, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13105, 3932, 13740, 15244, HTML_ENTITY_EMPTY_SLOT, 271, HTML_ENTITY_EMPTY_SLOT, 6332, 2745,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7837, 14400, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10493, 7825,
+    11646, 11197, 13580, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13573, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10266, HTML_ENTITY_EMPTY_SLOT, 10168,
+    HTML_ENTITY_EMPTY_SLOT, 1734, 8734, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1066, 2599, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9469, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 14590, 9338, 10978, 7925, 5290, HTML_ENTITY_EMPTY_SLOT,
+    5634, 850, HTML_ENTITY_EMPTY_SLOT, 12501, 1883, HTML_ENTITY_EMPTY_SLOT, 12441, 3872, 3807, 13124, HTML_ENTITY_EMPTY_SLOT, 14073,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5012, 3865, 15866, 1901, 10662, 14665, HTML_ENTITY_EMPTY_SLOT, 1965, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11190, 5684, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7392, HTML_ENTITY_EMPTY_SLOT, 2416, 11526, HTML_ENTITY_EMPTY_SLOT, 12257,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12529, 11466, HTML_ENTITY_EMPTY_SLOT, 6562, HTML_ENTITY_EMPTY_SLOT, 10901, 7209, 1509, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    8910, 9768, 5102, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 16021, 5564, HTML_ENTITY_EMPTY_SLOT, 3215, 4926, 6139, 6059,
+    11361, HTML_ENTITY_EMPTY_SLOT, 6040, HTML_ENTITY_EMPTY_SLOT, 3679, 2222, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13842, 15638,
+    13011, HTML_ENTITY_EMPTY_SLOT, 12978, 8798, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1551, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10058, 12338, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 3957, 175, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8477, 14371, 12034, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11621, 12392, 7547, HTML_ENTITY_EMPTY_SLOT, 2723, 6620, 15256, 9686, 13207, 13979,
+    6996, 14634, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 4880, 3085, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 2511, 667,
+    HTML_ENTITY_EMPTY_SLOT, 3534, 4665, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 4738, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9599, HTML_ENTITY_EMPTY_SLOT,
+    7066, 13524, HTML_ENTITY_EMPTY_SLOT, 2304, 11723, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9727, 8203, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    5794, 9105, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6830, 10127, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    10919, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 14856, HTML_ENTITY_EMPTY_SLOT, 5330, 8443, HTML_ENTITY_EMPTY_SLOT, 5373, 12521, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6812, HTML_ENTITY_EMPTY_SLOT, 8454, 11388, 4610, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 4985,
+    HTML_ENTITY_EMPTY_SLOT, 7387, 2718, 8189, 9417, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9184, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 14897, 7249, HTML_ENTITY_EMPTY_SLOT, 542, HTML_ENTITY_EMPTY_SLOT, 2017, 7875, HTML_ENTITY_EMPTY_SLOT, 7680,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 4314, HTML_ENTITY_EMPTY_SLOT, 10870, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12104, 11012, HTML_ENTITY_EMPTY_SLOT, 559, HTML_ENTITY_EMPTY_SLOT, 13643, 2776, 7315,
+    13076, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6733, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 14679, 111, HTML_ENTITY_EMPTY_SLOT, 30, 14868, 13616,
+    HTML_ENTITY_EMPTY_SLOT, 4096, HTML_ENTITY_EMPTY_SLOT, 8320, 11642, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9858, 4945, 4237, HTML_ENTITY_EMPTY_SLOT, 6588,
+    3747, 7137, HTML_ENTITY_EMPTY_SLOT, 509, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7421, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 14604,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13940, HTML_ENTITY_EMPTY_SLOT, 4128, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10189, HTML_ENTITY_EMPTY_SLOT, 14907,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6415, HTML_ENTITY_EMPTY_SLOT, 8352, 7380, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 7466, 5936, HTML_ENTITY_EMPTY_SLOT, 7432, 11807, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1657, 1391, HTML_ENTITY_EMPTY_SLOT, 12737,
+    6673, 6246, HTML_ENTITY_EMPTY_SLOT, 15016, HTML_ENTITY_EMPTY_SLOT, 7123, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15053, HTML_ENTITY_EMPTY_SLOT, 10303, 16115,
+    193, HTML_ENTITY_EMPTY_SLOT, 1383, 7472, HTML_ENTITY_EMPTY_SLOT, 9376, 7191, HTML_ENTITY_EMPTY_SLOT, 5783, HTML_ENTITY_EMPTY_SLOT, 5730, HTML_ENTITY_EMPTY_SLOT,
+    12076, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 347, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15278, HTML_ENTITY_EMPTY_SLOT, 11543, 3711,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15307, 6477, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12806, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 3310,
+    HTML_ENTITY_EMPTY_SLOT, 1806, 6690, 13202, HTML_ENTITY_EMPTY_SLOT, 11445, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11122, 14133,
+    4333, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 14943, HTML_ENTITY_EMPTY_SLOT, 6756, 10905, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 570,
+    HTML_ENTITY_EMPTY_SLOT, 7151, 2699, HTML_ENTITY_EMPTY_SLOT, 11516, 7460, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8809, 14749, 4349, HTML_ENTITY_EMPTY_SLOT,
+    14042, 11691, 684, 5347, 2257, 6026, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10940, HTML_ENTITY_EMPTY_SLOT, 10687,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 4870, HTML_ENTITY_EMPTY_SLOT, 10377, 150, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    1752, HTML_ENTITY_EMPTY_SLOT, 2321, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7444, 5410, 8928, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5702,
+    15935, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15203, 9909, 10881, 6150, HTML_ENTITY_EMPTY_SLOT, 5629, HTML_ENTITY_EMPTY_SLOT, 15437, 15432,
+    HTML_ENTITY_EMPTY_SLOT, 6602, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9630, HTML_ENTITY_EMPTY_SLOT, 1153, 10359, HTML_ENTITY_EMPTY_SLOT, 14862, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    12680, HTML_ENTITY_EMPTY_SLOT, 5601, 9143, 5221, HTML_ENTITY_EMPTY_SLOT, 2883, HTML_ENTITY_EMPTY_SLOT, 14092, HTML_ENTITY_EMPTY_SLOT, 5359, 6340,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15892, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11576, HTML_ENTITY_EMPTY_SLOT, 9534, HTML_ENTITY_EMPTY_SLOT, 12793, 11202, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15291, 14411, HTML_ENTITY_EMPTY_SLOT, 3851, 11472, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7571,
+    HTML_ENTITY_EMPTY_SLOT, 8759, 12046, 3571, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5006, 10701, HTML_ENTITY_EMPTY_SLOT,
+    13857, 15765, HTML_ENTITY_EMPTY_SLOT, 5472, HTML_ENTITY_EMPTY_SLOT, 4516, 6649, 3971, 461, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11926,
+    HTML_ENTITY_EMPTY_SLOT, 5866, 1679, 14120, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 14566, 12246, 3936, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    14036, HTML_ENTITY_EMPTY_SLOT, 11634, 10448, 2067, 13247, 3775, 8805, 6550, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    8292, 15907, HTML_ENTITY_EMPTY_SLOT, 1847, 7479, HTML_ENTITY_EMPTY_SLOT, 9964, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 988, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    2835, HTML_ENTITY_EMPTY_SLOT, 13293, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    13496, 12116, HTML_ENTITY_EMPTY_SLOT, 4118, 8288, 9073, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 24, 6859, 14064, HTML_ENTITY_EMPTY_SLOT,
+    10366, 8262, HTML_ENTITY_EMPTY_SLOT, 4082, 72, HTML_ENTITY_EMPTY_SLOT, 5905, 7656, HTML_ENTITY_EMPTY_SLOT, 13017, HTML_ENTITY_EMPTY_SLOT, 6544,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10825, 10404, 13048, 11370, 5810, 8132, 6089, HTML_ENTITY_EMPTY_SLOT, 10832, HTML_ENTITY_EMPTY_SLOT,
+    9607, HTML_ENTITY_EMPTY_SLOT, 2366, 15006, HTML_ENTITY_EMPTY_SLOT, 12236, 8933, HTML_ENTITY_EMPTY_SLOT, 4142, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11350,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12547, 7901, 1500, HTML_ENTITY_EMPTY_SLOT, 2673, 11754, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8986, 5996, HTML_ENTITY_EMPTY_SLOT, 7158, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1118,
+    104, 2401, 4576, 10410, 14793, 11419, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8449, 2112, 3940,
+    4972, 4792, HTML_ENTITY_EMPTY_SLOT, 5533, 11209, HTML_ENTITY_EMPTY_SLOT, 8827, 8008, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 16038, 6104,
+    10748, 5735, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 7952, 9506, 1081, 11815, HTML_ENTITY_EMPTY_SLOT, 3923, HTML_ENTITY_EMPTY_SLOT, 12000, 13945, 9058, 13922,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12564, 15332, HTML_ENTITY_EMPTY_SLOT, 6902, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15030, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8409, 8651, HTML_ENTITY_EMPTY_SLOT, 10540, 11131, 14342, 11156, 5927, 5990, 13153,
+    3627, 14308, 16088, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15777, HTML_ENTITY_EMPTY_SLOT, 8902, 4087, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 3016,
+    7327, 13507, 2917, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10933, HTML_ENTITY_EMPTY_SLOT, 514, HTML_ENTITY_EMPTY_SLOT, 12427, 13622,
+    HTML_ENTITY_EMPTY_SLOT, 7200, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10198, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6835, 14254, HTML_ENTITY_EMPTY_SLOT, 9718, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 4606, HTML_ENTITY_EMPTY_SLOT, 2940, 6976, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 3846, 1641, 4589, HTML_ENTITY_EMPTY_SLOT, 1819,
+    HTML_ENTITY_EMPTY_SLOT, 8389, HTML_ENTITY_EMPTY_SLOT, 1595, 4999, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9345, HTML_ENTITY_EMPTY_SLOT, 12829, 11240, 2001,
+    15996, 1218, 8107, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 816, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 4101,
+    HTML_ENTITY_EMPTY_SLOT, 471, 13777, 15611, 6073, HTML_ENTITY_EMPTY_SLOT, 11222, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11509, 8553,
+    HTML_ENTITY_EMPTY_SLOT, 12329, 10887, 13316, 12634, 10210, 7452, HTML_ENTITY_EMPTY_SLOT, 1211, 978, 13216, 86,
+    14965, 7279, 10416, 12447, HTML_ENTITY_EMPTY_SLOT, 8438, HTML_ENTITY_EMPTY_SLOT, 15553, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5217,
+    3697, 9762, HTML_ENTITY_EMPTY_SLOT, 2580, 10434, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 14538, 5606, 4262, 1494, HTML_ENTITY_EMPTY_SLOT,
+    8823, 12541, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13933, 15485, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10591, HTML_ENTITY_EMPTY_SLOT, 12014,
+    5972, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7258, HTML_ENTITY_EMPTY_SLOT, 12811, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10221, HTML_ENTITY_EMPTY_SLOT, 10650, 14930,
+    13399, 2500, HTML_ENTITY_EMPTY_SLOT, 5154, 1196, 14448, HTML_ENTITY_EMPTY_SLOT, 15262, 12154, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    8483, 9391, HTML_ENTITY_EMPTY_SLOT, 11552, 16076, 12089, 4502, 11391, 12379, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10645, 15753, 6275, 14742, 14705, 2468, HTML_ENTITY_EMPTY_SLOT, 6281, 11005, HTML_ENTITY_EMPTY_SLOT,
+    14956, HTML_ENTITY_EMPTY_SLOT, 7040, 830, 1987, 423, 8939, 14356, HTML_ENTITY_EMPTY_SLOT, 11568, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    5228, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10467, 1258, 15940, 1719, 1358, 12003, 12649, HTML_ENTITY_EMPTY_SLOT, 1464,
+    250, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1436, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15726, 9986, 1862, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 2726, 15420, 11952, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    9553, 14126, 8789, HTML_ENTITY_EMPTY_SLOT, 3151, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9545, HTML_ENTITY_EMPTY_SLOT, 1344, HTML_ENTITY_EMPTY_SLOT, 1798,
+    HTML_ENTITY_EMPTY_SLOT, 9709, 16093, 15378, 2731, 12277, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5300, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    518, 2433, 3340, HTML_ENTITY_EMPTY_SLOT, 9847, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1948, 11774, HTML_ENTITY_EMPTY_SLOT, 5838, HTML_ENTITY_EMPTY_SLOT,
+    8234, 7559, 6962, 15297, 12591, HTML_ENTITY_EMPTY_SLOT, 14808, 7022, 1332, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 6768, HTML_ENTITY_EMPTY_SLOT, 14497, 9588, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6714, 10946, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 4035, 6100, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15861, 7854, 2230, 13848,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5454, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5830, HTML_ENTITY_EMPTY_SLOT, 15367, 1907,
+    9208, 9112, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6739, HTML_ENTITY_EMPTY_SLOT, 13030, HTML_ENTITY_EMPTY_SLOT, 12843, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    8569, 5759, HTML_ENTITY_EMPTY_SLOT, 3988, 8041, HTML_ENTITY_EMPTY_SLOT, 15269, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 731, 12287, 8783, 7829, 753, 14733, 4002, HTML_ENTITY_EMPTY_SLOT, 6614, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    3207, 2738, HTML_ENTITY_EMPTY_SLOT, 10150, 8840, 13351, 10043, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5891, 875,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12180, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6422, 7244, HTML_ENTITY_EMPTY_SLOT, 5625, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 4533, 12123, HTML_ENTITY_EMPTY_SLOT, 2930, 8053, 13518, 9522, 15806, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6532,
+    HTML_ENTITY_EMPTY_SLOT, 12692, 14320, HTML_ENTITY_EMPTY_SLOT, 7360, 7580, HTML_ENTITY_EMPTY_SLOT, 4485, HTML_ENTITY_EMPTY_SLOT, 14625, 8644, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6068, 8880, 9840, HTML_ENTITY_EMPTY_SLOT, 210, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1028, HTML_ENTITY_EMPTY_SLOT, 8945,
+    9442, 8915, HTML_ENTITY_EMPTY_SLOT, 7717, 9305, 14281, 15680, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8426, 13891,
+    12660, 1189, 15312, 11780, HTML_ENTITY_EMPTY_SLOT, 9811, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 3782,
+    8193, HTML_ENTITY_EMPTY_SLOT, 13560, 13279, 6780, HTML_ENTITY_EMPTY_SLOT, 12888, 9951, 1018, HTML_ENTITY_EMPTY_SLOT, 11840, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5044, 8956, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 4219, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    12020, 11769, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7539, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7322, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12096,
+    HTML_ENTITY_EMPTY_SLOT, 14843, 12232, HTML_ENTITY_EMPTY_SLOT, 15346, 1513, 7788, 2483, 12472, HTML_ENTITY_EMPTY_SLOT, 11739, HTML_ENTITY_EMPTY_SLOT,
+    5643, HTML_ENTITY_EMPTY_SLOT, 15496, 5688, HTML_ENTITY_EMPTY_SLOT, 4658, 2795, 5639, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1134, 1048,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 3493, HTML_ENTITY_EMPTY_SLOT, 10164, 9370, 6918, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12850, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 7782, HTML_ENTITY_EMPTY_SLOT, 8700, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10792, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9299, 7868, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15372, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13005, 9734, 13712, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5018,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 2206, 5963, 7629, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    5882, 8596, 8462, 11938, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15721, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12600, HTML_ENTITY_EMPTY_SLOT,
+    10777, 13417, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15924, HTML_ENTITY_EMPTY_SLOT, 11340, 6938, HTML_ENTITY_EMPTY_SLOT, 11560, 9314,
+    HTML_ENTITY_EMPTY_SLOT, 5592, 627, HTML_ENTITY_EMPTY_SLOT, 15450, 1890, 8693, HTML_ENTITY_EMPTY_SLOT, 1758, 6865, 13196, HTML_ENTITY_EMPTY_SLOT,
+    9575, HTML_ENTITY_EMPTY_SLOT, 8308, 9124, 14772, HTML_ENTITY_EMPTY_SLOT, 11216, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 14479, 7108, HTML_ENTITY_EMPTY_SLOT,
+    8339, 4884, HTML_ENTITY_EMPTY_SLOT, 170, HTML_ENTITY_EMPTY_SLOT, 8526, 9750, 12534, 13553, HTML_ENTITY_EMPTY_SLOT, 9433, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8814, HTML_ENTITY_EMPTY_SLOT, 13035, HTML_ENTITY_EMPTY_SLOT, 6878, 9572, 6708, 8121, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 8417, HTML_ENTITY_EMPTY_SLOT, 3665, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8326, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    9804, HTML_ENTITY_EMPTY_SLOT, 8146, HTML_ENTITY_EMPTY_SLOT, 10142, 12344, 6310, 13286, HTML_ENTITY_EMPTY_SLOT, 14247, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6431, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 3771, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 16029,
+    HTML_ENTITY_EMPTY_SLOT, 5596, HTML_ENTITY_EMPTY_SLOT, 3802, 10310, 12301, HTML_ENTITY_EMPTY_SLOT, 8586, 3070, 13660, HTML_ENTITY_EMPTY_SLOT, 14918,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9957, 8403, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1233, 10656, 13654, HTML_ENTITY_EMPTY_SLOT, 2756,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5441, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1204, 12820, 14692, 11095, 9487, 8331, HTML_ENTITY_EMPTY_SLOT,
+    4773, 7668, 1487, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5719, HTML_ENTITY_EMPTY_SLOT, 14799, HTML_ENTITY_EMPTY_SLOT, 7910, 8546, 13602,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7967, 11611, 3976, HTML_ENTITY_EMPTY_SLOT, 6095, 10203, HTML_ENTITY_EMPTY_SLOT, 15647,
+    HTML_ENTITY_EMPTY_SLOT, 11329, HTML_ENTITY_EMPTY_SLOT, 9989, 9671, HTML_ENTITY_EMPTY_SLOT, 2713, HTML_ENTITY_EMPTY_SLOT, 14523, 1984, HTML_ENTITY_EMPTY_SLOT, 3979,
+    HTML_ENTITY_EMPTY_SLOT, 2057, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15843, 8862, 10316, 1925, HTML_ENTITY_EMPTY_SLOT, 7141, 6980, 7399,
+    17, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8665, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 14228, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 11698, 15520, 3788, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9256, 11582, 11493, HTML_ENTITY_EMPTY_SLOT, 5477,
+    HTML_ENTITY_EMPTY_SLOT, 6643, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10992, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1409, 1174, 10422, 13700,
+    7117, 12799, HTML_ENTITY_EMPTY_SLOT, 13877, 12465, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 5521, HTML_ENTITY_EMPTY_SLOT, 15736, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7054, HTML_ENTITY_EMPTY_SLOT, 14113, HTML_ENTITY_EMPTY_SLOT, 4671, HTML_ENTITY_EMPTY_SLOT,
+    4761, 537, HTML_ENTITY_EMPTY_SLOT, 13548, 10960, HTML_ENTITY_EMPTY_SLOT, 14336, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8508, 11317, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 9642, HTML_ENTITY_EMPTY_SLOT, 14881, 9202, HTML_ENTITY_EMPTY_SLOT, 11015, 1200, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11734,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8269, 9309, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 14022, HTML_ENTITY_EMPTY_SLOT, 13816,
+    14166, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 4467, HTML_ENTITY_EMPTY_SLOT, 4123, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10690, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10287, HTML_ENTITY_EMPTY_SLOT, 8972, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12718, HTML_ENTITY_EMPTY_SLOT, 11744,
+    8196, 15490, HTML_ENTITY_EMPTY_SLOT, 1767, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 186, 7753, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 3731,
+    1787, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 2040, 13224, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10528, HTML_ENTITY_EMPTY_SLOT, 14505,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9296, 14222, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5646, HTML_ENTITY_EMPTY_SLOT, 12478, 16048, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13722, 2669, 372, 6696, HTML_ENTITY_EMPTY_SLOT, 4805, HTML_ENTITY_EMPTY_SLOT, 7309, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15701, 4756, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13853, 7673, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 3760, HTML_ENTITY_EMPTY_SLOT, 7112, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15663, 12749, HTML_ENTITY_EMPTY_SLOT,
+    6727, 11430, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9972, HTML_ENTITY_EMPTY_SLOT, 10714, HTML_ENTITY_EMPTY_SLOT, 7487, 9623, HTML_ENTITY_EMPTY_SLOT,
+    14080, HTML_ENTITY_EMPTY_SLOT, 12900, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 595, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6884, HTML_ENTITY_EMPTY_SLOT, 8630, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 2163, HTML_ENTITY_EMPTY_SLOT, 5619, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 3032, 8345, 3414, 6684,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 14553, 7003, 410, 7757, 795, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1480, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6242, HTML_ENTITY_EMPTY_SLOT, 2497, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6349, HTML_ENTITY_EMPTY_SLOT, 7500, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    10803, 10808, HTML_ENTITY_EMPTY_SLOT, 15978, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10579, 9656, HTML_ENTITY_EMPTY_SLOT, 5243, 10798,
+    8906, HTML_ENTITY_EMPTY_SLOT, 5096, 4634, 13833, HTML_ENTITY_EMPTY_SLOT, 2100, 9453, 12707, 8981, 1370, 12641,
+    10584, HTML_ENTITY_EMPTY_SLOT, 6762, HTML_ENTITY_EMPTY_SLOT, 312, HTML_ENTITY_EMPTY_SLOT, 16097, HTML_ENTITY_EMPTY_SLOT, 12007, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8058,
+    416, 12174, HTML_ENTITY_EMPTY_SLOT, 13297, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5306, HTML_ENTITY_EMPTY_SLOT, 5546, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 15179, HTML_ENTITY_EMPTY_SLOT, 10352, 14102, 8180, 14425, 13705, 15081, 14713, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11309, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 3858, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1349, 13530, 12147, HTML_ENTITY_EMPTY_SLOT, 552, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 6048, 1459, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 4431, HTML_ENTITY_EMPTY_SLOT, 11395, 3656,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 10574, 10769, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9593, HTML_ENTITY_EMPTY_SLOT, 6595, 1873,
+    11078, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11249, 6667, HTML_ENTITY_EMPTY_SLOT, 11461, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    13826, HTML_ENTITY_EMPTY_SLOT, 10386, 9119, HTML_ENTITY_EMPTY_SLOT, 9895, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15690, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12064,
+    HTML_ENTITY_EMPTY_SLOT, 13264, HTML_ENTITY_EMPTY_SLOT, 12788, 4379, 1302, 8175, HTML_ENTITY_EMPTY_SLOT, 13967, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6969,
+    HTML_ENTITY_EMPTY_SLOT, 11334, 8672, 3895, 1778, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12614, 1647, 12863,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11867, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15455, 2659, 13680, 8728, 8801, 5671,
+    HTML_ENTITY_EMPTY_SLOT, 14574, 6702, 1534, 9037, 12384, 2243, 14925, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1568,
+    45, 11606, 8857, 12220, 11054, 4190, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 14737, HTML_ENTITY_EMPTY_SLOT, 10321, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12039, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 2650, 12413, HTML_ENTITY_EMPTY_SLOT,
+    6631, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12251, 5954, 1781, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    10619, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8950, 11043, 2447, HTML_ENTITY_EMPTY_SLOT, 11499, 9083, 13696, 8366, HTML_ENTITY_EMPTY_SLOT,
+    10909, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7532, HTML_ENTITY_EMPTY_SLOT, 9275, 5178, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 3794,
+    HTML_ENTITY_EMPTY_SLOT, 13762, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11400, 15386, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    8833, 8432, 9324, 15871, HTML_ENTITY_EMPTY_SLOT, 2619, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5446, 6463, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 722, 8281, HTML_ENTITY_EMPTY_SLOT, 13995, HTML_ENTITY_EMPTY_SLOT, 10229, 15624,
+    10346, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15108, 15502, HTML_ENTITY_EMPTY_SLOT, 8591, 15213, HTML_ENTITY_EMPTY_SLOT, 13746, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 57, 12730, 5210, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8540, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13783,
+    HTML_ENTITY_EMPTY_SLOT, 15707, 4959, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 2752, HTML_ENTITY_EMPTY_SLOT, 5806, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8093, HTML_ENTITY_EMPTY_SLOT,
+    6896, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11678, 9358, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13956, 12225, HTML_ENTITY_EMPTY_SLOT, 10968, 3379,
+    HTML_ENTITY_EMPTY_SLOT, 11409, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5750, 9664, HTML_ENTITY_EMPTY_SLOT, 16110, 4858, HTML_ENTITY_EMPTY_SLOT,
+    16010, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7514, 4073, 9173, HTML_ENTITY_EMPTY_SLOT, 10597, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9516, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 12456, 13568, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1634, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 5945, 1651, HTML_ENTITY_EMPTY_SLOT,
+    1244, 6797, 5509, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6841, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8707,
+    4295, 3328, 8230, HTML_ENTITY_EMPTY_SLOT, 8241, HTML_ENTITY_EMPTY_SLOT, 4149, HTML_ENTITY_EMPTY_SLOT, 14874, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    6789, 4215, 2191, 2961, 5069, 38, 14265, HTML_ENTITY_EMPTY_SLOT, 9180, 2080, 11820, 9636,
+    13864, 13536, HTML_ENTITY_EMPTY_SLOT, 9100, 577, 6406, HTML_ENTITY_EMPTY_SLOT, 9796, HTML_ENTITY_EMPTY_SLOT, 14315, 14390, 14031,
+    12483, HTML_ENTITY_EMPTY_SLOT, 16102, 10555, 284, 6293, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9382, 6871, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15529, 1674, 12210, 4601, 5113, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13607, HTML_ENTITY_EMPTY_SLOT, 324,
+    8745, HTML_ENTITY_EMPTY_SLOT, 8217, HTML_ENTITY_EMPTY_SLOT, 7692, 8714, 7301, 6945, HTML_ENTITY_EMPTY_SLOT, 10562, 8574, HTML_ENTITY_EMPTY_SLOT,
+    14783, 14672, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 6110, 12263, 335, 12571, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 8183, 166,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13056, 97, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 1762, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13182, HTML_ENTITY_EMPTY_SLOT, 9495,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 9420, HTML_ENTITY_EMPTY_SLOT, 5234, 14545, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 12164, HTML_ENTITY_EMPTY_SLOT, 7017, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 7763, HTML_ENTITY_EMPTY_SLOT, 15960, 14303, 11109, 15882, HTML_ENTITY_EMPTY_SLOT, 7942, HTML_ENTITY_EMPTY_SLOT,
+    8076, HTML_ENTITY_EMPTY_SLOT, 2006, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 4060, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 4571, 5651, HTML_ENTITY_EMPTY_SLOT,
+    13166, HTML_ENTITY_EMPTY_SLOT, 10566, 13118, 5800, 12879, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 5726, HTML_ENTITY_EMPTY_SLOT, 2981, HTML_ENTITY_EMPTY_SLOT, 7977, 1521, HTML_ENTITY_EMPTY_SLOT, 6189, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    HTML_ENTITY_EMPTY_SLOT, 5311, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 4560, 11325, 15819, 1454, 928, 11910, HTML_ENTITY_EMPTY_SLOT,
+    7074, 12051, 6013, HTML_ENTITY_EMPTY_SLOT, 14085, HTML_ENTITY_EMPTY_SLOT, 2391, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11415, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT,
+    15597, 8658, 0, HTML_ENTITY_EMPTY_SLOT, 5850, 2689, 8978, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 11231,
+    1431, HTML_ENTITY_EMPTY_SLOT, 12883, 4041, 13611, 9869, 2377, 6125, 6052, 5128, 9618, HTML_ENTITY_EMPTY_SLOT,
+    10280, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 15127, 5200, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 14432, 14533,
+    HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, HTML_ENTITY_EMPTY_SLOT, 13669, 13595, HTML_ENTITY_EMPTY_SLOT, 11482, HTML_ENTITY_EMPTY_SLOT, 10736, 10953,
+    HTML_ENTITY_EMPTY_SLOT, 2181, 11289, 7598,
+};
+
+static inline uint32_t html_entity_hash(const char *name, uint32_t length, uint32_t seed) {
+    uint32_t hash = 2166136261u ^ seed;
+    for (uint32_t i = 0; i < length; i++) {
+        hash = (hash ^ (unsigned char)name[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Determines if `name` (without the `&` and `;`) is the name of an html entity.
+static inline bool is_html_entity(const char *name, uint32_t length) {
+    uint32_t bucket = html_entity_hash(name, length, 0) & (HTML_ENTITY_BUCKET_COUNT - 1);
+    uint32_t slot = html_entity_hash(name, length, HTML_ENTITY_SEEDS[bucket]) & (HTML_ENTITY_SLOT_COUNT - 1);
+    if (HTML_ENTITY_SLOTS[slot] == HTML_ENTITY_EMPTY_SLOT) return false;
+    const char *candidate = HTML_ENTITY_NAMES + HTML_ENTITY_SLOTS[slot];
+    return strncmp(candidate, name, length) == 0 && candidate[length] == '\0';
+}
+
+#endif  // TREE_SITTER_MARKDOWN_HTML_ENTITIES_H_
@@ -1,12 +1,24 @@
 #include <tree_sitter/parser.h>
+#include "html_entities.h"
 #include <cassert>
-#include <vector>
 #include <cstring>
 #include <algorithm>
-#include <iostream>
+#ifdef MARKDOWN_SCANNER_STATS
+#include "scanner_stats.h"
+#include <atomic>
+#endif
 
-using std::vector;
 using std::memcpy;
+using std::memmove;
+
+// The grammars in `block` and `inline` use the same external tokens as this grammar and share this
+// scanner. They include this file after defining `EXTERNAL_SCANNER` to export the scanner under
+// the name of their language.
+#ifndef EXTERNAL_SCANNER
+#define EXTERNAL_SCANNER(function) tree_sitter_markdown_external_scanner_##function
+#endif
+
+namespace {
 
 // For explanation of the tokens see grammar.js
 enum TokenType {
@@ -40,24 +52,152 @@ enum TokenType {
     BLANK_LINE_START,
     FENCED_CODE_BLOCK_END_BACKTICK,
     FENCED_CODE_BLOCK_END_TILDE,
+    CODE_LINE,
+    HTML_BLOCK_START,
+    HTML_BLOCK_LINE,
     OPEN_BLOCK,
     OPEN_BLOCK_DONT_INTERRUPT_PARAGRAPH,
     CLOSE_BLOCK,
     NO_INDENTED_CHUNK,
-    SPLIT_TOKEN,
     SOFT_LINE_BREAK_MARKER,
     ERROR,
     TRIGGER_ERROR,
     CODE_SPAN_START,
     CODE_SPAN_CLOSE,
+    UNMATCHED_CODE_SPAN_DELIMITER,
     EMPHASIS_OPEN_STAR,
     EMPHASIS_OPEN_UNDERSCORE,
     EMPHASIS_CLOSE_STAR,
     EMPHASIS_CLOSE_UNDERSCORE,
+    UNMATCHED_EMPHASIS_DELIMITER,
+    TEXT_RUN,
+    ENTITY_REFERENCE,
+    HTML_TAG_LINE,
+    HTML_TAG_END,
+    LINK_OPEN,
+    IMAGE_OPEN,
+    LINK_CLOSE_INLINE,
+    LINK_CLOSE_FULL_REFERENCE,
+    LINK_CLOSE_COLLAPSED_REFERENCE,
+    LINK_CLOSE_SHORTCUT,
+    DEGRADED_TEXT,
     LAST_TOKEN_WHITESPACE,
     LAST_TOKEN_PUNCTUATION,
 };
 
+// Determines if a character is ascii punctuation as defined by the markdown spec. Takes the whole
+// code point, so characters outside of ascii are never punctuation.
+bool is_punctuation(int32_t c) {
+    return
+        (c >= '!' && c <= '/') ||
+        (c >= ':' && c <= '@') ||
+        (c >= '[' && c <= '`') ||
+        (c >= '{' && c <= '~');
+}
+
+// Determines if a character is ascii whitespace as defined by the markdown spec.
+bool is_whitespace(int32_t c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// Determines if a character can be part of a `TEXT_RUN`, which are the characters the `$._word`
+// token of the grammar accepts. Spaces and tabs are only allowed between other characters.
+bool is_text_run_character(int32_t c) {
+    return c != 0 && (c >= 128 || (!is_punctuation(c) && !is_whitespace(c)));
+}
+
+static_assert(LAST_TOKEN_PUNCTUATION < 64, "token sets must fit into 64 bits");
+
+// A set of tokens as a bit mask
+constexpr uint64_t token_set(TokenType token) {
+    return (uint64_t)1 << token;
+}
+
+// Tokens that do not depend on the character at the current position. Some of them are zero
+// width, the others decide based on state that is not visible from the current character, like
+// the indentation left over from a previous token.
+const uint64_t POSITION_INDEPENDENT_TOKENS =
+    token_set(LINE_ENDING) | token_set(OPEN_BLOCK) | token_set(OPEN_BLOCK_DONT_INTERRUPT_PARAGRAPH) |
+    token_set(CLOSE_BLOCK) | token_set(TRIGGER_ERROR) | token_set(INDENTED_CHUNK_START) |
+    token_set(CODE_LINE) | token_set(HTML_BLOCK_LINE);
+
+// The tokens for the `]` that closes the text of a link or the description of an image. They are
+// always valid together.
+const uint64_t LINK_CLOSE_TOKENS =
+    token_set(LINK_CLOSE_INLINE) | token_set(LINK_CLOSE_FULL_REFERENCE) |
+    token_set(LINK_CLOSE_COLLAPSED_REFERENCE) | token_set(LINK_CLOSE_SHORTCUT);
+
+// The tokens that can start an element at the top level of inline content
+const uint64_t INLINE_START_TOKENS =
+    token_set(CODE_SPAN_START) | token_set(UNMATCHED_CODE_SPAN_DELIMITER) |
+    token_set(EMPHASIS_OPEN_STAR) | token_set(EMPHASIS_OPEN_UNDERSCORE) |
+    token_set(UNMATCHED_EMPHASIS_DELIMITER) | token_set(TEXT_RUN) | token_set(ENTITY_REFERENCE) |
+    token_set(HTML_TAG_LINE) | token_set(HTML_TAG_END) | token_set(LINK_OPEN) | token_set(IMAGE_OPEN);
+
+// The tokens that the non-matching part of the scanner can emit when the first non-whitespace
+// character is `c`. This mirrors the `switch` at the center of `Scanner::scan_token`.
+uint64_t tokens_starting_with(int32_t c) {
+    switch (c) {
+        case '\r':
+        case '\n':
+            return token_set(BLANK_LINE_START);
+        case '`':
+            return
+                token_set(FENCED_CODE_BLOCK_START_BACKTICK) | token_set(FENCED_CODE_BLOCK_END_BACKTICK) |
+                token_set(CODE_SPAN_START) | token_set(CODE_SPAN_CLOSE) |
+                token_set(UNMATCHED_CODE_SPAN_DELIMITER);
+        case '*':
+            return
+                token_set(THEMATIC_BREAK) | token_set(LIST_MARKER_STAR) |
+                token_set(LIST_MARKER_STAR_DONT_INTERRUPT) | token_set(EMPHASIS_OPEN_STAR) |
+                token_set(EMPHASIS_CLOSE_STAR) | token_set(UNMATCHED_EMPHASIS_DELIMITER);
+        case '_':
+            return
+                token_set(THEMATIC_BREAK) | token_set(EMPHASIS_OPEN_UNDERSCORE) |
+                token_set(EMPHASIS_CLOSE_UNDERSCORE) | token_set(UNMATCHED_EMPHASIS_DELIMITER);
+        case '>':
+            return token_set(BLOCK_QUOTE_START);
+        case '&':
+            return token_set(ENTITY_REFERENCE);
+        case '<':
+            return token_set(HTML_BLOCK_START) | token_set(HTML_TAG_LINE) | token_set(HTML_TAG_END);
+        case '[':
+            return token_set(LINK_OPEN);
+        case '!':
+            return token_set(IMAGE_OPEN);
+        case ']':
+            return LINK_CLOSE_TOKENS;
+        case '~':
+            return token_set(FENCED_CODE_BLOCK_START_TILDE) | token_set(FENCED_CODE_BLOCK_END_TILDE);
+        case '#':
+            return token_set(ATX_H1_MARKER);
+        case '=':
+            return token_set(SETEXT_H1_UNDERLINE);
+        case '+':
+            return token_set(LIST_MARKER_PLUS) | token_set(LIST_MARKER_PLUS_DONT_INTERRUPT);
+        case '0': case '1': case '2': case '3': case '4':
+        case '5': case '6': case '7': case '8': case '9':
+            return
+                token_set(LIST_MARKER_PARENTHESIS) | token_set(LIST_MARKER_DOT) |
+                token_set(LIST_MARKER_PARENTHESIS_DONT_INTERRUPT) |
+                token_set(LIST_MARKER_DOT_DONT_INTERRUPT) | token_set(TEXT_RUN);
+        case '-':
+            return
+                token_set(THEMATIC_BREAK) | token_set(SETEXT_H2_UNDERLINE) |
+                token_set(LIST_MARKER_MINUS) | token_set(LIST_MARKER_MINUS_DONT_INTERRUPT);
+        default:
+            return is_text_run_character(c) ? token_set(TEXT_RUN) : 0;
+    }
+}
+
+// Determines if any token of `tokens` is valid.
+bool any_valid(uint64_t tokens, const bool *valid_symbols) {
+    for (int i = 0; tokens != 0; i++, tokens >>= 1) {
+        if ((tokens & 1) && valid_symbols[i]) return true;
+    }
+    return false;
+}
+
 // Description of a block on the block stack.
 //
 // LIST_ITEM is a list item with minimal indentation (content begins at indent level 2) while
@@ -66,69 +206,561 @@ enum TokenType {
 //
 // ANONYMOUS represents any block that whose close is not handled by the external scanner. (Usually
 // opened using OPEN_BLOCK and closed using CLOSE_BLOCK).
+//
+// HTML_BLOCK_1 to HTML_BLOCK_5 are html blocks of the respective type, which end on the line that
+// contains their end condition. HTML_BLOCK_6 is an html block of type 6 or 7, both end at a blank
+// line.
 enum Block : uint8_t {
     BLOCK_QUOTE,
     INDENTED_CODE_BLOCK,
     LIST_ITEM = 2,
     LIST_ITEM_MAX_INDENTATION = 17,
     FENCED_CODE_BLOCK,
-    ANONYMOUS
+    ANONYMOUS,
+    HTML_BLOCK_1,
+    HTML_BLOCK_2,
+    HTML_BLOCK_3,
+    HTML_BLOCK_4,
+    HTML_BLOCK_5,
+    HTML_BLOCK_6,
 };
 
-// Returns true if the block represents a list item
-bool is_list_item(Block block) {
-    return block >= LIST_ITEM && block <= LIST_ITEM_MAX_INDENTATION;
-}
-
 // Returns the indentation level which lines of a list item should have at minimum. Should only be
-// called with blocks for which `is_list_item` returns true. 
+// called with blocks between `LIST_ITEM` and `LIST_ITEM_MAX_INDENTATION`.
 uint8_t list_item_indentation(Block block) {
     return block - LIST_ITEM + 2;
 }
 
-// Determines if a character is punctuation as defined by the markdown spec.
-bool is_punctuation(char c) {
+// Returns true if the block is an html block that ends on the line containing its end condition
+// instead of at a blank line
+bool html_block_has_end_condition(Block block) {
+    return block >= HTML_BLOCK_1 && block <= HTML_BLOCK_5;
+}
+
+// EMPHASIS
+//
+// Emphasis is resolved by the external scanner using the delimiter run algorithm of the spec.
+// See https://github.github.com/gfm/#can-open-emphasis and
+// https://github.github.com/gfm/#phase-2-inline-structure
+//
+// Delimiters are emitted one character at a time. When the first delimiter of a run is scanned the
+// scanner looks ahead for closing delimiter runs and decides how many of the delimiters will be
+// matched. Only those are emitted as `EMPHASIS_OPEN_*`, the rest of the run is emitted as
+// `UNMATCHED_EMPHASIS_DELIMITER`, which the grammar treats as text. The open delimiter runs are
+// remembered on a small stack, so closing delimiter runs can be matched without looking back.
+
+// Maximum number of bytes to look ahead when searching for closing delimiter runs
+const size_t EMPHASIS_LOOKAHEAD_LIMIT = 4096;
+// Maximum number of open delimiter runs. Further opening delimiter runs are treated as text.
+const size_t EMPHASIS_STACK_SIZE = 16;
+
+// The type of the characters surrounding a delimiter run. The beginning and end of a line count as
+// whitespace.
+enum CharacterType : uint8_t {
+    CHARACTER_OTHER,
+    CHARACTER_WHITESPACE,
+    CHARACTER_PUNCTUATION,
+};
+
+// Characters outside of ascii count as `CHARACTER_OTHER`, as the scanner has no tables of unicode
+// whitespace and punctuation.
+CharacterType character_type(int32_t c) {
+    if (c == 0 || is_whitespace(c)) return CHARACTER_WHITESPACE;
+    if (is_punctuation(c)) return CHARACTER_PUNCTUATION;
+    return CHARACTER_OTHER;
+}
+
+// How a paragraph goes on after a line ending when looking ahead. Only blank lines and the end of
+// the file certainly end a paragraph. Other lines that might start a new block are only detected
+// approximately.
+enum ParagraphLine : uint8_t {
+    PARAGRAPH_CONTINUES,
+    PARAGRAPH_ENDS,
+    PARAGRAPH_MAY_END,
+};
+
+// A delimiter run, i.e. a sequence of `*` or `_` characters.
+struct DelimiterRun {
+    char character;
+    uint8_t length;
+    bool can_open;
+    bool can_close;
+};
+
+// Determines if a delimiter run can open and / or close emphasis based on the characters before
+// and after the run.
+//
+// https://github.github.com/gfm/#left-flanking-delimiter-run
+DelimiterRun delimiter_run(char character, size_t length, CharacterType before, CharacterType after) {
+    bool left_flanking = after != CHARACTER_WHITESPACE &&
+        (after != CHARACTER_PUNCTUATION || before != CHARACTER_OTHER);
+    bool right_flanking = before != CHARACTER_WHITESPACE &&
+        (before != CHARACTER_PUNCTUATION || after != CHARACTER_OTHER);
+    DelimiterRun run;
+    run.character = character;
+    if (character == '*') {
+        run.can_open = left_flanking;
+        run.can_close = right_flanking;
+    } else {
+        run.can_open = left_flanking && (!right_flanking || before == CHARACTER_PUNCTUATION);
+        run.can_close = right_flanking && (!left_flanking || after == CHARACTER_PUNCTUATION);
+    }
+    // Longer runs can not be counted in the scanner state and are always treated as text
+    if (length > UINT8_MAX) {
+        length = UINT8_MAX;
+        run.can_open = false;
+        run.can_close = false;
+    }
+    run.length = length;
+    return run;
+}
+
+// Open delimiters of a delimiter run on the emphasis stack
+struct EmphasisDelimiter {
+    char character;
+    // Length of the whole delimiter run modulo 3
+    uint8_t length_mod_3;
+    // The delimiter run could also close emphasis
+    bool both_flanking;
+    // Number of delimiters of the run that are still open
+    uint8_t count;
+};
+
+// The "rule of 3": If one of the delimiters can both open and close emphasis, then the sum of the
+// lengths of the delimiter runs containing the opening and closing delimiters must not be a
+// multiple of 3 unless both lengths are multiples of 3.
+bool rule_of_3(const EmphasisDelimiter &opener, uint8_t closer_length_mod_3, bool closer_both_flanking) {
+    if (!opener.both_flanking && !closer_both_flanking) return true;
+    if ((opener.length_mod_3 + closer_length_mod_3) % 3 != 0) return true;
+    return opener.length_mod_3 == 0 && closer_length_mod_3 == 0;
+}
+
+// Feed a delimiter run to a delimiter stack as in the "process emphasis" procedure of the spec.
+// Returns false as soon as the delimiters at index `bottom` were all matched or got removed from
+// the stack.
+bool process_delimiter_run(
+    EmphasisDelimiter *stack,
+    size_t &size,
+    size_t capacity,
+    size_t bottom,
+    const DelimiterRun &run
+) {
+    uint8_t remaining = run.length;
+    bool both_flanking = run.can_open && run.can_close;
+    while (run.can_close && remaining > 0) {
+        size_t opener = size;
+        for (size_t i = size; i > 0; i--) {
+            if (
+                stack[i - 1].character == run.character &&
+                rule_of_3(stack[i - 1], run.length % 3, both_flanking)
+            ) {
+                opener = i - 1;
+                break;
+            }
+        }
+        if (opener == size) break;
+        // Matching an opener removes all openers above it. If this removes the delimiters at
+        // `bottom` they will never be matched.
+        if (opener < bottom) return false;
+        size = opener + 1;
+        uint8_t used = remaining >= 2 && stack[opener].count >= 2 ? 2 : 1;
+        stack[opener].count -= used;
+        remaining -= used;
+        if (stack[opener].count == 0) {
+            size--;
+            if (opener == bottom) return false;
+        }
+    }
+    if (run.can_open && remaining > 0 && size < capacity) {
+        stack[size++] = {run.character, uint8_t(run.length % 3), both_flanking, remaining};
+    }
+    return true;
+}
+
+// CODE SPANS
+//
+// A code span start is only emitted if a closing backtick string of the same length follows in the
+// same paragraph. Otherwise the backtick string is emitted as `UNMATCHED_CODE_SPAN_DELIMITER`,
+// which the grammar treats as text.
+//
+// Looking ahead for a closing backtick string that does not exist means scanning to the end of
+// the paragraph. To not do this for every further backtick string the scanner remembers how many
+// backtick strings of each length follow in the paragraph. This cache is part of the serialized
+// state and is updated when backtick strings are consumed. A backtick string is only known to be
+// unmatched if it is the last of its length. For all others the scanner still looks ahead, but
+// only up to the closing backtick string.
+//
+// Longer backtick strings are not tracked by the cache. Every unmatched one of them would scan to
+// the end of the paragraph, so the lookahead for them is limited instead. Code spans delimited by
+// more than `CODE_SPAN_CACHE_SIZE` backticks and longer than the limit are not recognized.
+
+// Number of backtick string lengths tracked by the code span cache, starting at length 1
+const size_t CODE_SPAN_CACHE_SIZE = 8;
+// Maximum number of bytes to look ahead for the closing backtick string of a code span whose
+// length is not tracked by the code span cache
+const size_t CODE_SPAN_LOOKAHEAD_LIMIT = 4096;
+// Count in the code span cache for lengths whose number of backtick strings is unknown
+const uint8_t CODE_SPAN_CACHE_UNKNOWN = UINT8_MAX;
+
+// HTML
+//
+// The external scanner decides which of the seven kinds of html blocks starts on a line, see
+// https://github.github.com/gfm/#html-blocks, and recognizes inline html, see
+// https://github.github.com/gfm/#raw-html. Tag names are compared case insensitively by
+// converting them to lower case and looking them up in the sorted tables below.
+
+// Tag names that start an html block of type 1
+constexpr const char *HTML_BLOCK_1_TAG_NAMES[] = {"pre", "script", "style"};
+// Tag names that start an html block of type 6
+constexpr const char *HTML_BLOCK_6_TAG_NAMES[] = {
+    "address", "article", "aside", "base", "basefont", "blockquote", "body", "caption", "center",
+    "col", "colgroup", "dd", "details", "dialog", "dir", "div", "dl", "dt", "fieldset", "figcaption",
+    "figure", "footer", "form", "frame", "frameset", "h1", "h2", "h3", "h4", "h5", "h6", "head",
+    "header", "hr", "html", "iframe", "legend", "li", "link", "main", "menu", "menuitem", "nav",
+    "noframes", "ol", "optgroup", "option", "p", "param", "section", "source", "summary", "table",
+    "tbody", "td", "tfoot", "th", "thead", "title", "tr", "track", "ul"
+};
+// Length of the longest tag name in the tables. Longer tag names are never looked up.
+const size_t HTML_BLOCK_TAG_NAME_MAX_LENGTH = 10;
+
+constexpr size_t string_length(const char *s) {
+    return *s == 0 ? 0 : 1 + string_length(s + 1);
+}
+
+constexpr bool string_less(const char *a, const char *b) {
+    return *a != *b ? (unsigned char)*a < (unsigned char)*b : *a != 0 && string_less(a + 1, b + 1);
+}
+
+// Determines if a table of tag names is sorted and has no name longer than
+// HTML_BLOCK_TAG_NAME_MAX_LENGTH, which the lookup relies on.
+constexpr bool is_tag_name_table(const char *const *names, size_t count) {
+    return count == 0 || (
+        string_length(names[0]) <= HTML_BLOCK_TAG_NAME_MAX_LENGTH &&
+        (count == 1 || string_less(names[0], names[1])) &&
+        is_tag_name_table(names + 1, count - 1)
+    );
+}
+
+static_assert(
+    is_tag_name_table(HTML_BLOCK_1_TAG_NAMES, sizeof(HTML_BLOCK_1_TAG_NAMES) / sizeof(char *)),
+    "HTML_BLOCK_1_TAG_NAMES must be sorted"
+);
+static_assert(
+    is_tag_name_table(HTML_BLOCK_6_TAG_NAMES, sizeof(HTML_BLOCK_6_TAG_NAMES) / sizeof(char *)),
+    "HTML_BLOCK_6_TAG_NAMES must be sorted"
+);
+
+// Determines if a character can be part of an attribute name. The first character is more
+// restricted.
+//
+// https://github.github.com/gfm/#attribute-name
+bool is_attribute_name_character(int32_t c, bool first) {
     return
-        (c >= '!' && c <= '/') ||
-        (c >= ':' && c <= '@') ||
-        (c >= '[' && c <= '`') ||
-        (c >= '{' && c <= '~');
+        (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == ':' ||
+        (!first && ((c >= '0' && c <= '9') || c == '.' || c == '-'));
 }
 
-// Determines if a character is ascii whitespace as defined by the markdown spec.
-bool is_whitespace(char c) {
-    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+// Determines if the lower case tag name `name` is part of a table of tag names.
+template <size_t N>
+bool is_tag_name_in(const char *const (&names)[N], const char *name) {
+    return std::binary_search(names, names + N, name, [](const char *a, const char *b) {
+        return strcmp(a, b) < 0;
+    });
 }
 
+// How inline html that spans several lines ends. Stored in `STATE_HTML_TAG` while the lines of
+// the html are emitted one by one.
+enum HtmlTagEnd : uint8_t {
+    HTML_TAG_END_NONE,
+    // `-->`
+    HTML_TAG_END_COMMENT,
+    // `?>`
+    HTML_TAG_END_PROCESSING_INSTRUCTION,
+    // `]]>`
+    HTML_TAG_END_CDATA,
+    // The next `>`
+    HTML_TAG_END_DECLARATION,
+    // The next `>` outside of a quoted attribute value
+    HTML_TAG_END_TAG,
+    // Inside a double quoted attribute value of a tag
+    HTML_TAG_END_DOUBLE_QUOTED,
+    // Inside a single quoted attribute value of a tag
+    HTML_TAG_END_SINGLE_QUOTED,
+};
+
+// Maximum number of characters the scanner looks ahead to check that inline html is complete.
+// Longer html is left to the grammar as plain text.
+const size_t HTML_TAG_LOOKAHEAD_LIMIT = 4096;
+
+// Progress of the lookahead through inline html
+struct HtmlLookahead {
+    // Number of open block quotes, whose markers are skipped on continuation lines
+    size_t block_quotes;
+    // Number of characters looked at so far
+    size_t consumed;
+    // The html has to end on the current line
+    bool single_line;
+    // How the html ends on the next line, if it does not end on the first one
+    HtmlTagEnd first_line_end;
+};
+
+// LINKS
+//
+// The external scanner matches the brackets of links and images, see `$._link_text` in
+// grammar.js. This way a bracket that can not be part of a link is plain text right away and the
+// kind of link is known at its closing bracket.
+
+// Maximum number of characters the scanner looks ahead for the closing bracket of a link and for
+// what follows it
+const size_t LINK_LOOKAHEAD_LIMIT = 4096;
+// Maximum depth of the links and images nested in the text of a link or the description of an
+// image. The opening bracket of a link with more deeply nested content is plain text. This way a
+// character is looked at by the lookahead of at most this many enclosing brackets, otherwise every
+// bracket of a long run of nested images like `![![![` would be scanned up to the lookahead limit.
+const size_t LINK_NESTING_LIMIT = 32;
+// Maximum number of code spans, autolinks and html in the text of a link whose end is looked for
+// at the same time, see `find_link_close`. Link text with more is plain text.
+const size_t LINK_PENDING_SPAN_LIMIT = 8;
+
+// Progress of the lookahead through a link
+struct LinkLookahead {
+    // Number of open block quotes, whose markers are skipped on continuation lines
+    size_t block_quotes;
+    // Number of characters looked at so far
+    size_t consumed;
+};
+
+// A backtick string or `<` in the text of a link that opens a code span, an autolink or html if
+// it gets closed
+struct PendingSpan {
+    // Length of the backtick string, 0 for a `<`
+    uint8_t length;
+    // Number of nested links and images that were open before it
+    size_t nested;
+};
+
+// Outcome of the lookahead for the closing bracket of a link
+enum LinkSearch {
+    LINK_SEARCHING,
+    LINK_FOUND,
+    LINK_FAILED,
+};
+
+// DEGRADED INLINE CONTENT
+//
+// Minified or generated documents can contain single paragraphs of hundreds of kilobytes. Parsing
+// their inline content in full keeps many parse versions alive for a long time, so paragraphs
+// longer than `DEGRADED_INLINE_THRESHOLD` bytes are parsed in a cheap mode instead, see
+// `$._degraded_inline` in grammar.js.
+//
+// The first token the scanner emits at the top level of a paragraph looks ahead to the end of the
+// paragraph, once per paragraph, see `Scanner::scan_deciding_degraded_inline`. If the paragraph is
+// longer than the threshold everything after that token is degraded: Only code spans and
+// backslash escapes are recognized, the text between them is emitted as `DEGRADED_TEXT` up to the
+// end of the line. Elements that are already open, like the link or emphasis started by the first
+// token, are parsed in full until they end.
+//
+// The threshold can be changed by defining `MARKDOWN_DEGRADED_INLINE_THRESHOLD` when compiling
+// the scanner. 0 disables the degraded mode.
+#ifndef MARKDOWN_DEGRADED_INLINE_THRESHOLD
+#define MARKDOWN_DEGRADED_INLINE_THRESHOLD (64 * 1024)
+#endif
+const size_t DEGRADED_INLINE_THRESHOLD = MARKDOWN_DEGRADED_INLINE_THRESHOLD;
+
 // State bitflags used with `Scanner.state`
 
 // Currently matching (at the beginning of a line)
-const uint16_t STATE_MATCHING = 0x1 << 0;
-// Last line break was inside a paragraph
-const uint16_t STATE_WAS_SOFT_LINE_BREAK = 0x1 << 1;
-// TODO
-const uint16_t STATE_EMPHASIS_DELIMITER_MOD_3 = 0x3 << 2;
-// Current delimiter run is opening
-const uint16_t STATE_EMPHASIS_DELIMITER_IS_OPEN = 0x1 << 4;
-// Number of consecutive SPLIT_TOKEN emitted
-const uint16_t STATE_SPLIT_TOKEN_COUNT = 0x3 << 5;
+const uint32_t STATE_MATCHING = 0x1 << 0;
+// The current line ending inside a paragraph is a soft line break, see `paragraph_continues`.
+// Once the open blocks are matched a SOFT_LINE_BREAK_MARKER is emitted instead of closing them.
+const uint32_t STATE_SOFT_LINE_BREAK = 0x1 << 1;
+// Length of the current emphasis delimiter run modulo 3
+const uint32_t STATE_EMPHASIS_DELIMITER_MOD_3 = 0x3 << 2;
+// The remaining delimiters of the current delimiter run are emitted as unmatched delimiters
+// followed by the opening delimiters on top of the emphasis stack
+const uint32_t STATE_EMPHASIS_DELIMITER_IS_OPEN = 0x1 << 4;
+// A lookahead reached the end of the current paragraph without passing a delimiter run of `*` or
+// `_` that can close emphasis. Later delimiter runs of that character in the paragraph can not be
+// matched either, so they skip the lookahead. Otherwise a paragraph full of delimiter runs that can
+// only open emphasis, like `*a *a *a`, would be scanned to its end for every one of them. Reset at
+// the end of the paragraph.
+const uint32_t STATE_EMPHASIS_NO_CLOSER_STAR = 0x1 << 5;
+const uint32_t STATE_EMPHASIS_NO_CLOSER_UNDERSCORE = 0x1 << 6;
+const uint32_t STATE_EMPHASIS_NO_CLOSER =
+    STATE_EMPHASIS_NO_CLOSER_STAR | STATE_EMPHASIS_NO_CLOSER_UNDERSCORE;
 // Block should be closed after next line break
-const uint16_t STATE_CLOSE_BLOCK = 0x1 << 7;
-// Paragraph was just closed. Error if no new block opens
-const uint16_t STATE_NEED_OPEN_BLOCK = 0x1 << 8; 
-// Basically the same as STATE_NEED_OPEN_BLOCK. I am actually not sure about the difference. This
-// shoudl be investigated.
-const uint16_t STATE_JUST_CLOSED = 0x1 << 9;
+const uint32_t STATE_CLOSE_BLOCK = 0x1 << 7;
+// The inline content of the current paragraph is degraded, see DEGRADED INLINE CONTENT
+const uint32_t STATE_DEGRADED_INLINE = 0x1 << 8;
+// A block was closed on the current line, so an empty list item on it can start a list
+const uint32_t STATE_JUST_CLOSED = 0x1 << 9;
+// Current delimiter run can open emphasis
+const uint32_t STATE_EMPHASIS_DELIMITER_CAN_OPEN = 0x1 << 10;
+// Current delimiter run can close emphasis and has not failed to close yet
+const uint32_t STATE_EMPHASIS_DELIMITER_CAN_CLOSE = 0x1 << 11;
+// Currently parsing the content of an ATX heading, which ends at the end of the line
+const uint32_t STATE_ATX_HEADING = 0x1 << 12;
+// `Scanner.code_span_cache` is valid
+const uint32_t STATE_CODE_SPAN_CACHE = 0x1 << 13;
+
+// End condition of inline html that continues on the next line, see `HtmlTagEnd`
+const uint32_t STATE_HTML_TAG = 0x7 << 14;
+const size_t STATE_HTML_TAG_SHIFT = 14;
+// The length of the current paragraph was already checked against `DEGRADED_INLINE_THRESHOLD`
+const uint32_t STATE_DEGRADED_INLINE_DECIDED = 0x1 << 17;
+const uint32_t STATE_DEGRADED = STATE_DEGRADED_INLINE | STATE_DEGRADED_INLINE_DECIDED;
+
+// SERIALIZATION
+//
+// The scanner state is serialized after every external token and stored with the token.
+// Tree-sitter stores states of up to 24 bytes inline and allocates larger ones on the heap, so the
+// encoding is kept compact: The first byte has a flag for every field that is not zero and only
+// those fields follow, as varints. Open blocks are packed with 5 bits per block. A scanner state
+// where all fields are zero serializes to nothing.
+//
+// Deserializing never reads past the end of the buffer and clamps the sizes of the emphasis stack
+// and the block stack, so even a corrupted state can not make the scanner access memory out of
+// bounds. Tree-sitter only ever passes states written by `serialize`, but the fuzzer in `fuzz`
+// passes arbitrary ones.
+
+// Fields present in the serialized state
+const uint8_t SERIALIZED_STATE = 0x1 << 0;
+const uint8_t SERIALIZED_MATCHED = 0x1 << 1;
+const uint8_t SERIALIZED_INDENTATION = 0x1 << 2;
+const uint8_t SERIALIZED_COLUMN = 0x1 << 3;
+const uint8_t SERIALIZED_CODE_SPAN_DELIMITER_LENGTH = 0x1 << 4;
+const uint8_t SERIALIZED_NUM_EMPHASIS_DELIMITERS_LEFT = 0x1 << 5;
+const uint8_t SERIALIZED_EMPHASIS_STACK = 0x1 << 6;
+const uint8_t SERIALIZED_OPEN_BLOCKS = 0x1 << 7;
+
+// Number of bits used for a single open block
+const size_t BLOCK_BITS = 5;
+
+// Maximum size of the varint encoding of a value with `bits` bits
+constexpr size_t varint_size(size_t bits) {
+    return (bits + 6) / 7;
+}
+
+// Write `value` as a varint: 7 bits per byte starting with the lowest ones. The highest bit of a
+// byte is set if another byte follows.
+size_t write_varint(char *buffer, size_t i, uint32_t value) {
+    while (value >= 0x80) {
+        buffer[i++] = (char)(value | 0x80);
+        value >>= 7;
+    }
+    buffer[i++] = (char)value;
+    return i;
+}
+
+// Read a varint written by `write_varint` from a buffer of `length` bytes. A varint that is cut off
+// by the end of the buffer ends there, bits beyond 32 are dropped.
+uint32_t read_varint(const char *buffer, unsigned length, size_t &i) {
+    uint32_t value = 0;
+    for (size_t shift = 0; i < length; shift += 7) {
+        uint8_t byte = buffer[i++];
+        if (shift < 32) value |= (uint32_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) break;
+    }
+    return value;
+}
+
+// Maximum size of the serialized scanner state without the open blocks. See `Scanner::serialize`.
+const size_t MAX_SERIALIZED_STATE_SIZE =
+    1 + varint_size(18) + varint_size(16) + 4 * varint_size(8) +
+    varint_size(8) + EMPHASIS_STACK_SIZE * varint_size(12) +
+    varint_size(8) + CODE_SPAN_CACHE_SIZE * varint_size(8) +
+    varint_size(16);
+// Maximum number of open blocks, so the serialized state always fits into tree-sitter's buffer
+const size_t MAX_OPEN_BLOCKS =
+    (TREE_SITTER_SERIALIZATION_BUFFER_SIZE - MAX_SERIALIZED_STATE_SIZE) * 8 / BLOCK_BITS;
+
+// A stack of open blocks with a fixed capacity. It lives inside of the scanner, so scanning,
+// serializing and deserializing never allocate.
+struct BlockStack {
+    Block blocks[MAX_OPEN_BLOCKS];
+    uint16_t count;
+
+    size_t size() const { return count; }
+    bool full() const { return count == MAX_OPEN_BLOCKS; }
+    void push_back(Block block) { assert(!full()); blocks[count++] = block; }
+    void pop_back() { count--; }
+    Block &operator[](size_t i) { return blocks[i]; }
+    const Block *begin() const { return blocks; }
+    const Block *end() const { return blocks + count; }
+};
+
+// Number of bytes of the UTF-8 encoding of a code point
+size_t utf8_length(int32_t c) {
+    return c < 0x80 ? 1 : c < 0x800 ? 2 : c < 0x10000 ? 3 : 4;
+}
+
+// A lexer that forwards to the lexer of the parser and keeps track of the bytes the scanner
+// consumes and where it ends the token. Must be the first member, so the functions can cast the
+// `TSLexer` they get back. Used to decide whether a paragraph is degraded, see
+// `Scanner::scan_deciding_degraded_inline`, and for the counters of `MARKDOWN_SCANNER_STATS`.
+struct CountingLexer {
+    TSLexer lexer;
+    TSLexer *inner;
+    // Bytes consumed so far and up to the last `mark_end`
+    uint64_t consumed;
+    uint64_t marked;
+    bool has_mark;
+    // Whether a line ending was consumed
+    bool line_ending;
+
+    explicit CountingLexer(TSLexer *inner) :
+        inner(inner), consumed(0), marked(0), has_mark(false), line_ending(false) {
+        lexer.lookahead = inner->lookahead;
+        lexer.result_symbol = inner->result_symbol;
+        lexer.advance = advance;
+        lexer.mark_end = mark_end;
+        lexer.get_column = get_column;
+        lexer.is_at_included_range_start = is_at_included_range_start;
+        lexer.eof = eof;
+    }
+
+    static CountingLexer *of(const TSLexer *lexer) {
+        return (CountingLexer *)lexer;
+    }
+
+    static void advance(TSLexer *lexer, bool skip) {
+        CountingLexer *self = of(lexer);
+        int32_t c = self->inner->lookahead;
+        if (!self->inner->eof(self->inner)) self->consumed += utf8_length(c);
+        if (c == '\n' || c == '\r') self->line_ending = true;
+        self->inner->advance(self->inner, skip);
+        lexer->lookahead = self->inner->lookahead;
+    }
+
+    static void mark_end(TSLexer *lexer) {
+        CountingLexer *self = of(lexer);
+        self->inner->mark_end(self->inner);
+        self->marked = self->consumed;
+        self->has_mark = true;
+    }
+
+    static uint32_t get_column(TSLexer *lexer) {
+        return of(lexer)->inner->get_column(of(lexer)->inner);
+    }
+
+    static bool is_at_included_range_start(const TSLexer *lexer) {
+        return of(lexer)->inner->is_at_included_range_start(of(lexer)->inner);
+    }
+
+    static bool eof(const TSLexer *lexer) {
+        return of(lexer)->inner->eof(of(lexer)->inner);
+    }
+};
 
 struct Scanner {
 
     // A stack of open blocks in the current parse state
-    vector<Block> open_blocks;
+    BlockStack open_blocks;
     // Parser state flags
-    uint16_t state;
+    uint32_t state;
     // Number of blocks that have been matched so far. Only changes during matching and is reset
     // after every line ending
-    uint8_t matched;
+    uint16_t matched;
     // Consumed but "unused" indentation. Sometimes a tab needs to be "split" to be used in
     // multiple tokens.
     uint8_t indentation;
@@ -138,29 +770,79 @@ struct Scanner {
     uint8_t code_span_delimiter_length;
     // The number of characters remaining in the currrent emphasis delimiter run.
     uint8_t num_emphasis_delimiters_left;
+    // The open emphasis delimiter runs. See the comment on EMPHASIS above.
+    EmphasisDelimiter emphasis_stack[EMPHASIS_STACK_SIZE];
+    uint8_t emphasis_stack_size;
+    // Number of backtick strings of each length up to the end of the paragraph, including the
+    // current line and `code_span_cache_lines` further lines. See the comment on CODE SPANS above.
+    uint8_t code_span_cache[CODE_SPAN_CACHE_SIZE];
+    uint8_t code_span_cache_lines;
 
     Scanner() {
         assert(sizeof(Block) == sizeof(char));
+        assert(HTML_BLOCK_6 < (0x1 << BLOCK_BITS));
         assert(ATX_H6_MARKER == ATX_H1_MARKER + 5);
         deserialize(NULL, 0);
     }
 
-    // Write the whole state of a Scanner to a byte buffer
+    // Write the whole state of a Scanner to a byte buffer. See the comment on SERIALIZATION above.
     unsigned serialize(char *buffer) {
+        uint8_t fields =
+            (state ? SERIALIZED_STATE : 0) |
+            (matched ? SERIALIZED_MATCHED : 0) |
+            (indentation ? SERIALIZED_INDENTATION : 0) |
+            (column ? SERIALIZED_COLUMN : 0) |
+            (code_span_delimiter_length ? SERIALIZED_CODE_SPAN_DELIMITER_LENGTH : 0) |
+            (num_emphasis_delimiters_left ? SERIALIZED_NUM_EMPHASIS_DELIMITERS_LEFT : 0) |
+            (emphasis_stack_size ? SERIALIZED_EMPHASIS_STACK : 0) |
+            (open_blocks.count ? SERIALIZED_OPEN_BLOCKS : 0);
+        if (fields == 0) return 0;
         size_t i = 0;
-        buffer[i++] = state;
-        memcpy(&buffer[i], &state, sizeof(uint16_t));
-        i += sizeof(uint16_t);
-        buffer[i++] = matched;
-        buffer[i++] = indentation;
-        buffer[i++] = column;
-        buffer[i++] = code_span_delimiter_length;
-        buffer[i++] = num_emphasis_delimiters_left;
-        size_t blocks_count = open_blocks.size();
-        if (blocks_count > UINT8_MAX - i) blocks_count = UINT8_MAX - i;
-        if (blocks_count > 0) {
-            memcpy(&buffer[i], open_blocks.data(), blocks_count);
-            i += blocks_count;
+        buffer[i++] = fields;
+        if (fields & SERIALIZED_STATE) i = write_varint(buffer, i, state);
+        if (fields & SERIALIZED_MATCHED) i = write_varint(buffer, i, matched);
+        if (fields & SERIALIZED_INDENTATION) i = write_varint(buffer, i, indentation);
+        if (fields & SERIALIZED_COLUMN) i = write_varint(buffer, i, column);
+        if (fields & SERIALIZED_CODE_SPAN_DELIMITER_LENGTH) {
+            i = write_varint(buffer, i, code_span_delimiter_length);
+        }
+        if (fields & SERIALIZED_NUM_EMPHASIS_DELIMITERS_LEFT) {
+            i = write_varint(buffer, i, num_emphasis_delimiters_left);
+        }
+        if (fields & SERIALIZED_EMPHASIS_STACK) {
+            i = write_varint(buffer, i, emphasis_stack_size);
+            for (size_t j = 0; j < emphasis_stack_size; j++) {
+                const EmphasisDelimiter &delimiter = emphasis_stack[j];
+                i = write_varint(
+                    buffer,
+                    i,
+                    delimiter.count << 4 |
+                    (delimiter.character == '_') << 3 |
+                    delimiter.length_mod_3 << 1 |
+                    delimiter.both_flanking
+                );
+            }
+        }
+        if (state & STATE_CODE_SPAN_CACHE) {
+            i = write_varint(buffer, i, code_span_cache_lines);
+            for (size_t j = 0; j < CODE_SPAN_CACHE_SIZE; j++) {
+                i = write_varint(buffer, i, code_span_cache[j]);
+            }
+        }
+        if (fields & SERIALIZED_OPEN_BLOCKS) {
+            i = write_varint(buffer, i, open_blocks.count);
+            uint32_t bits = 0;
+            size_t bit_count = 0;
+            for (size_t j = 0; j < open_blocks.count; j++) {
+                bits |= (uint32_t)open_blocks[j] << bit_count;
+                bit_count += BLOCK_BITS;
+                while (bit_count >= 8) {
+                    buffer[i++] = (char)bits;
+                    bits >>= 8;
+                    bit_count -= 8;
+                }
+            }
+            if (bit_count > 0) buffer[i++] = (char)bits;
         }
         return i;
     }
@@ -168,28 +850,62 @@ struct Scanner {
     // Read the whole state of a Scanner from a byte buffer
     // `serizalize` and `deserialize` should be fully symmetric.
     void deserialize(const char *buffer, unsigned length) {
-        open_blocks.clear();
+        open_blocks.count = 0;
         state = 0;
         matched = 0;
         indentation = 0;
         column = 0;
         code_span_delimiter_length = 0;
         num_emphasis_delimiters_left = 0;
+        emphasis_stack_size = 0;
+        code_span_cache_lines = 0;
         if (length > 0) {
             size_t i = 0;
-            state = buffer[i++];
-            memcpy(&state, &buffer[i], sizeof(uint16_t));
-            i += sizeof(uint16_t);
-            matched = buffer[i++];
-            indentation = buffer[i++];
-            column = buffer[i++];
-            code_span_delimiter_length = buffer[i++];
-            num_emphasis_delimiters_left = buffer[i++];
-            size_t blocks_count = length - i;
-            open_blocks.resize(blocks_count);
-            if (blocks_count > 0) {
-                memcpy(open_blocks.data(), &buffer[i], blocks_count);
+            uint8_t fields = buffer[i++];
+            if (fields & SERIALIZED_STATE) state = read_varint(buffer, length, i);
+            if (fields & SERIALIZED_MATCHED) matched = read_varint(buffer, length, i);
+            if (fields & SERIALIZED_INDENTATION) indentation = read_varint(buffer, length, i);
+            if (fields & SERIALIZED_COLUMN) column = read_varint(buffer, length, i);
+            if (fields & SERIALIZED_CODE_SPAN_DELIMITER_LENGTH) {
+                code_span_delimiter_length = read_varint(buffer, length, i);
+            }
+            if (fields & SERIALIZED_NUM_EMPHASIS_DELIMITERS_LEFT) {
+                num_emphasis_delimiters_left = read_varint(buffer, length, i);
+            }
+            if (fields & SERIALIZED_EMPHASIS_STACK) {
+                emphasis_stack_size =
+                    std::min<uint32_t>(read_varint(buffer, length, i), EMPHASIS_STACK_SIZE);
+                for (size_t j = 0; j < emphasis_stack_size; j++) {
+                    uint32_t value = read_varint(buffer, length, i);
+                    EmphasisDelimiter &delimiter = emphasis_stack[j];
+                    delimiter.count = value >> 4;
+                    delimiter.character = value & (0x1 << 3) ? '_' : '*';
+                    delimiter.length_mod_3 = (value >> 1) & 0x3;
+                    delimiter.both_flanking = value & 0x1;
+                }
+            }
+            if (state & STATE_CODE_SPAN_CACHE) {
+                code_span_cache_lines = read_varint(buffer, length, i);
+                for (size_t j = 0; j < CODE_SPAN_CACHE_SIZE; j++) {
+                    code_span_cache[j] = read_varint(buffer, length, i);
+                }
+            }
+            if (fields & SERIALIZED_OPEN_BLOCKS) {
+                open_blocks.count =
+                    std::min<uint32_t>(read_varint(buffer, length, i), MAX_OPEN_BLOCKS);
+                uint32_t bits = 0;
+                size_t bit_count = 0;
+                for (size_t j = 0; j < open_blocks.count; j++) {
+                    if (bit_count < BLOCK_BITS) {
+                        if (i < length) bits |= (uint32_t)(uint8_t)buffer[i++] << bit_count;
+                        bit_count += 8;
+                    }
+                    open_blocks[j] = Block(bits & ((0x1 << BLOCK_BITS) - 1));
+                    bits >>= BLOCK_BITS;
+                    bit_count -= BLOCK_BITS;
+                }
             }
+            if (matched > open_blocks.count) matched = open_blocks.count;
         }
     }
 
@@ -201,74 +917,231 @@ struct Scanner {
         if (lexer->lookahead == '\t') {
             size = (column % 4 == 0) ? 4 : (4 - column % 4);
         }
+        // Wrapping around on long lines keeps the tab stops right, as 256 is a multiple of 4
         column += size;
         lexer->advance(lexer, false);
         return size;
     }
 
-    // Convenience function to emit the error token. This is done to stop invalid parse branches.
-    // Specifically:
-    // 1. When encountering a newline after a line break that ended a paragraph, and no new block
-    //    has been opened.
-    // 2. When encountering a new block after a soft line break.
-    // 3. When a `$._trigger_error` token is valid, which is used to stop parse branches through
-    //    normal tree-sitter grammar rules.
-    //
-    // See also the `$._soft_line_break` and `$._paragraph_end_newline` tokens in grammar.js
+    // Add consumed whitespace to `indentation`. Saturates instead of wrapping around, so a very
+    // long run of whitespace can not turn into a small indentation.
+    void add_indentation(size_t size) {
+        indentation = std::min<size_t>(indentation + size, UINT8_MAX);
+    }
+
+    // Convenience function to emit the error token. This is done to stop invalid parse branches
+    // when a `$._trigger_error` token is valid, which is used to stop parse branches through
+    // normal tree-sitter grammar rules. See `$.link_title` in grammar.js
     bool error(TSLexer *lexer) {
         lexer->result_symbol = ERROR;
         return true;
     }
 
     bool scan(TSLexer *lexer, const bool *valid_symbols) {
+        if (!may_start_token(lexer, valid_symbols)) return false;
+        if (
+            DEGRADED_INLINE_THRESHOLD > 0 &&
+            valid_symbols[DEGRADED_TEXT] &&
+            !(state & (STATE_DEGRADED_INLINE_DECIDED | STATE_MATCHING))
+        ) {
+            return scan_deciding_degraded_inline(lexer, valid_symbols);
+        }
+        if (!scan_token(lexer, valid_symbols)) return false;
+        canonicalize(lexer->result_symbol);
+        return true;
+    }
+
+    // `scan` at the top level of a paragraph that was not checked against
+    // `DEGRADED_INLINE_THRESHOLD` yet. The first inline token emitted here decides whether the rest
+    // of the paragraph is degraded: Once the token is ended, the scanner looks ahead to the end of
+    // the paragraph, so the lookahead does not change the token. See DEGRADED INLINE CONTENT above.
+    //
+    // If the token itself looked ahead past a line ending, the lexer might already be in another
+    // paragraph. The next token decides instead.
+    bool scan_deciding_degraded_inline(TSLexer *lexer, const bool *valid_symbols) {
+        CountingLexer counting(lexer);
+        if (!scan_token(&counting.lexer, valid_symbols)) return false;
+        TSSymbol symbol = counting.lexer.result_symbol;
+        lexer->result_symbol = symbol;
+        canonicalize(symbol);
+        if (!(INLINE_START_TOKENS & token_set((TokenType)symbol)) || counting.line_ending) return true;
+        // Without a call of `mark_end` the token ends where the scanner stopped
+        if (!counting.has_mark) lexer->mark_end(lexer);
+        state |= STATE_DEGRADED_INLINE_DECIDED;
+        if (paragraph_longer_than(lexer, counting.consumed, DEGRADED_INLINE_THRESHOLD)) {
+            state |= STATE_DEGRADED_INLINE;
+        }
+        return true;
+    }
+
+    // Determines from the valid symbols and the current character whether `scan_token` could emit
+    // anything here, without consuming any input.
+    //
+    // The parser calls the scanner before every token, but most positions are inside of inline
+    // content where only a handful of characters can start an external token. This lets the
+    // internal lexer take over right away for all other characters.
+    bool may_start_token(TSLexer *lexer, const bool *valid_symbols) {
+        // Matching block continuations and closing blocks at the end of the file are not bound to
+        // a single character
+        if (state & STATE_MATCHING) return true;
+        // The end of inline html on a later line can be anywhere on the line
+        if (state & STATE_HTML_TAG) return true;
+        // Degraded text starts at almost any character
+        if ((state & STATE_DEGRADED_INLINE) && valid_symbols[DEGRADED_TEXT]) return true;
+        int32_t c = lexer->lookahead;
+        if (c == ' ' || c == '\t' || c == 0) return true;
+        if (any_valid(POSITION_INDEPENDENT_TOKENS, valid_symbols)) return true;
+        return any_valid(tokens_starting_with(c), valid_symbols);
+    }
+
+    // Reset the fields of the state that can not affect any later token to fixed values.
+    //
+    // In an incremental parse tree-sitter only reuses a subtree if the serialized scanner state
+    // before it is exactly the same as in the old tree. Without this, a value that is no longer
+    // used, like the length of the last code span, would differ in every state after an edit.
+    void canonicalize(TSSymbol symbol) {
+        switch (symbol) {
+            case CODE_SPAN_CLOSE:
+                code_span_delimiter_length = 0;
+                // fall through
+            case CODE_SPAN_START:
+            case UNMATCHED_CODE_SPAN_DELIMITER:
+            case EMPHASIS_OPEN_STAR:
+            case EMPHASIS_OPEN_UNDERSCORE:
+            case EMPHASIS_CLOSE_STAR:
+            case EMPHASIS_CLOSE_UNDERSCORE:
+            case UNMATCHED_EMPHASIS_DELIMITER:
+            case TEXT_RUN:
+            case ENTITY_REFERENCE:
+            case HTML_TAG_LINE:
+            case HTML_TAG_END:
+            case LINK_OPEN:
+            case IMAGE_OPEN:
+            case LINK_CLOSE_INLINE:
+            case LINK_CLOSE_FULL_REFERENCE:
+            case LINK_CLOSE_COLLAPSED_REFERENCE:
+            case LINK_CLOSE_SHORTCUT:
+            case DEGRADED_TEXT:
+            case CODE_LINE:
+            case HTML_BLOCK_LINE:
+                // No block can start on the rest of the line after inline content, so the fields
+                // only used for block structure are not needed until the next line ending.
+                column = 0;
+                matched = 0;
+                break;
+            case FENCED_CODE_BLOCK_END_BACKTICK:
+            case FENCED_CODE_BLOCK_END_TILDE:
+                code_span_delimiter_length = 0;
+                break;
+            case FENCED_CODE_BLOCK_START_BACKTICK:
+            case FENCED_CODE_BLOCK_START_TILDE:
+                // The delimiter length is needed to close the code block
+                emphasis_stack_size = 0;
+                state &=
+                    ~(STATE_CODE_SPAN_CACHE | STATE_EMPHASIS_NO_CLOSER | STATE_DEGRADED);
+                break;
+            case BLOCK_CLOSE:
+            case BLOCK_QUOTE_START:
+            case INDENTED_CHUNK_START:
+            case ATX_H1_MARKER:
+            case ATX_H2_MARKER:
+            case ATX_H3_MARKER:
+            case ATX_H4_MARKER:
+            case ATX_H5_MARKER:
+            case ATX_H6_MARKER:
+            case SETEXT_H1_UNDERLINE:
+            case SETEXT_H2_UNDERLINE:
+            case THEMATIC_BREAK:
+            case LIST_MARKER_MINUS:
+            case LIST_MARKER_PLUS:
+            case LIST_MARKER_STAR:
+            case LIST_MARKER_PARENTHESIS:
+            case LIST_MARKER_DOT:
+            case LIST_MARKER_MINUS_DONT_INTERRUPT:
+            case LIST_MARKER_PLUS_DONT_INTERRUPT:
+            case LIST_MARKER_STAR_DONT_INTERRUPT:
+            case LIST_MARKER_PARENTHESIS_DONT_INTERRUPT:
+            case LIST_MARKER_DOT_DONT_INTERRUPT:
+            case BLANK_LINE_START:
+            case HTML_BLOCK_START:
+                // These end the current paragraph, so nothing inline can be open anymore. A
+                // fenced code block is always the innermost block, so it can not be open after
+                // another block closed.
+                code_span_delimiter_length = 0;
+                emphasis_stack_size = 0;
+                state &= ~(
+                    STATE_CODE_SPAN_CACHE | STATE_HTML_TAG | STATE_EMPHASIS_NO_CLOSER |
+                    STATE_DEGRADED
+                );
+                break;
+        }
+    }
+
+    bool scan_token(TSLexer *lexer, const bool *valid_symbols) {
         // A normal tree-sitter rule decided that the current branch is invalid and now "requests"
         // an error to stop the branch
         if (valid_symbols[TRIGGER_ERROR]) {
             return error(lexer);
         }
 
-        // If we already matched all currently open blocks and just parsed a
-        // `$._paragraph_end_newline` leave the matching state.
-        uint8_t split_token_count = (state & STATE_SPLIT_TOKEN_COUNT) >> 5;
-        if (
-            split_token_count == 2 &&
-            !valid_symbols[SOFT_LINE_BREAK_MARKER] &&
-            matched == open_blocks.size()
-        ) {
-            state &= ~STATE_MATCHING;
+        // Blocks can not be nested deeper than the block stack allows. Once it is full anything
+        // that would open another block is treated as text.
+        bool restricted_valid_symbols[LAST_TOKEN_PUNCTUATION + 1];
+        if (open_blocks.full()) {
+            memcpy(restricted_valid_symbols, valid_symbols, sizeof(restricted_valid_symbols));
+            for (int i = LIST_MARKER_MINUS; i <= FENCED_CODE_BLOCK_START_TILDE; i++) {
+                restricted_valid_symbols[i] = false;
+            }
+            restricted_valid_symbols[BLOCK_QUOTE_START] = false;
+            restricted_valid_symbols[INDENTED_CHUNK_START] = false;
+            restricted_valid_symbols[HTML_BLOCK_START] = false;
+            restricted_valid_symbols[OPEN_BLOCK] = false;
+            restricted_valid_symbols[OPEN_BLOCK_DONT_INTERRUPT_PARAGRAPH] = false;
+            valid_symbols = restricted_valid_symbols;
         }
 
         // The parser just encountered a line break. Setup the state correspondingly
         if (valid_symbols[LINE_ENDING]) {
-            // If the last line break ended a paragraph and no new block opened, the last line
-            // break should have been a soft line break
-            if (state & STATE_NEED_OPEN_BLOCK) return error(lexer);
             // Reset the counter for matched blocks
             matched = 0;
-            // If there is at least one open block, we should be in the matching state.
-            // Also set the matching flag if a `$._soft_line_break_marker` can be emitted so it
-            // does get emitted.
-            if (valid_symbols[SOFT_LINE_BREAK_MARKER] || open_blocks.size() > 0) {
-                state |= STATE_MATCHING;
-            } else {
-                state &= (~STATE_MATCHING);
+            // Emphasis in ATX headings can not span multiple lines
+            if (state & STATE_ATX_HEADING) {
+                emphasis_stack_size = 0;
+                state &= ~STATE_EMPHASIS_NO_CLOSER;
             }
             // reset some state variables
             state &=
-                (~STATE_WAS_SOFT_LINE_BREAK) &
-                (~STATE_SPLIT_TOKEN_COUNT) &
-                (~STATE_NEED_OPEN_BLOCK) &
-                (~STATE_JUST_CLOSED);
+                (~STATE_SOFT_LINE_BREAK) &
+                (~STATE_JUST_CLOSED) &
+                (~STATE_ATX_HEADING);
             indentation = 0;
             column = 0;
+            // The token does not contain anything of the next line, which is only looked at to
+            // decide whether a line ending inside a paragraph is a soft line break
+            lexer->mark_end(lexer);
+            if (valid_symbols[SOFT_LINE_BREAK_MARKER] && paragraph_continues(lexer)) {
+                state |= STATE_SOFT_LINE_BREAK;
+            }
+            // If there is at least one open block, we should be in the matching state. Also set
+            // the matching flag if a `$._soft_line_break_marker` should be emitted so it does get
+            // emitted.
+            if ((state & STATE_SOFT_LINE_BREAK) || open_blocks.size() > 0) {
+                state |= STATE_MATCHING;
+            } else {
+                state &= (~STATE_MATCHING);
+            }
+            // The code span cache only covers the lines up to the end of the paragraph
+            if (code_span_cache_lines == 0) {
+                state &= ~STATE_CODE_SPAN_CACHE;
+            } else {
+                code_span_cache_lines--;
+            }
             lexer->result_symbol = LINE_ENDING;
             return true;
         }
 
         // Open a new (anonymous) block as requested. See `$._open_block` in grammar.js
         if (valid_symbols[OPEN_BLOCK] || valid_symbols[OPEN_BLOCK_DONT_INTERRUPT_PARAGRAPH]) {
-            if (state & STATE_WAS_SOFT_LINE_BREAK) return error(lexer);
-            if (valid_symbols[OPEN_BLOCK]) state &= ~STATE_NEED_OPEN_BLOCK;
             open_blocks.push_back(ANONYMOUS);
             lexer->result_symbol =
                 valid_symbols[OPEN_BLOCK] ? OPEN_BLOCK : OPEN_BLOCK_DONT_INTERRUPT_PARAGRAPH;
@@ -283,11 +1156,59 @@ struct Scanner {
             return true;
         }
 
+        // Lines of code blocks are taken as a whole. This also consumes their leading whitespace,
+        // which would otherwise be part of the indentation.
+        if (valid_symbols[CODE_LINE] && !(state & STATE_MATCHING) && parse_code_line(lexer, valid_symbols)) {
+            return true;
+        }
+        if (valid_symbols[HTML_BLOCK_LINE] && !(state & STATE_MATCHING) && parse_html_block_line(lexer, valid_symbols)) {
+            return true;
+        }
+
+        // The inline content of a degraded paragraph, including whitespace
+        if (
+            (state & STATE_DEGRADED_INLINE) &&
+            valid_symbols[DEGRADED_TEXT] &&
+            !(state & STATE_MATCHING) &&
+            lexer->lookahead != '`' &&
+            lexer->lookahead != '\n' &&
+            lexer->lookahead != '\r' &&
+            !lexer->eof(lexer)
+        ) {
+            return parse_degraded_text(lexer);
+        }
+
+        // A further line of inline html that did not end on the previous line
+        if ((state & STATE_HTML_TAG) && valid_symbols[HTML_TAG_END] && !(state & STATE_MATCHING)) {
+            return parse_html_tag_continuation(lexer);
+        }
+
+        // Inline html and entity references are checked before consuming any whitespace, which
+        // can not be part of the token
+        if (lexer->lookahead == '<' && valid_symbols[HTML_TAG_END] && !(state & STATE_MATCHING)) {
+            return parse_html(lexer, valid_symbols, false);
+        }
+        if (lexer->lookahead == '&' && valid_symbols[ENTITY_REFERENCE] && !(state & STATE_MATCHING)) {
+            return parse_entity_reference(lexer);
+        }
+
+        // Brackets of links and images
+        if (
+            (lexer->lookahead == '[' || lexer->lookahead == '!') &&
+            (valid_symbols[LINK_OPEN] || valid_symbols[IMAGE_OPEN]) &&
+            !(state & STATE_MATCHING)
+        ) {
+            return parse_link_open(lexer, valid_symbols);
+        }
+        if (lexer->lookahead == ']' && any_valid(LINK_CLOSE_TOKENS, valid_symbols) && !(state & STATE_MATCHING)) {
+            return parse_link_close(lexer);
+        }
+
         // Parse any preceeding whitespace and remember its length. This makes a lot of parsing
         // quite a bit easier.
         for (;;) {
             if (lexer->lookahead == ' ' || lexer->lookahead == '\t') {
-                indentation += advance(lexer);
+                add_indentation(advance(lexer));
             } else {
                 break;
             }
@@ -319,11 +1240,17 @@ struct Scanner {
             switch (lexer->lookahead) {
                 case '\r':
                 case '\n':
-                    if (valid_symbols[BLANK_LINE_START]) {
+                    // In html blocks of type 1 to 5 an empty line is just another line of the
+                    // block
+                    if (
+                        valid_symbols[BLANK_LINE_START] &&
+                        (open_blocks.size() == 0 || !html_block_has_end_condition(open_blocks[open_blocks.size() - 1]))
+                    ) {
                         // A blank line token is actually just 0 width, so do not consume the
                         // characters
-                        if (state & STATE_WAS_SOFT_LINE_BREAK) return error(lexer);
-                        state &= ~STATE_NEED_OPEN_BLOCK;
+                        // Blank lines end paragraphs, so no emphasis can be open anymore
+                        emphasis_stack_size = 0;
+                        state &= ~STATE_CODE_SPAN_CACHE;
                         lexer->result_symbol = BLANK_LINE_START;
                         return true;
                     }
@@ -344,8 +1271,6 @@ struct Scanner {
                     break;
                 case '>':
                     if (valid_symbols[BLOCK_QUOTE_START]) {
-                        if (state & STATE_WAS_SOFT_LINE_BREAK) return error(lexer);
-                        state &= ~STATE_NEED_OPEN_BLOCK;
                         advance(lexer);
                         indentation = 0;
                         if (lexer->lookahead == ' ' || lexer->lookahead == '\t') {
@@ -356,6 +1281,8 @@ struct Scanner {
                         return true;
                     }
                     break;
+                case '<':
+                    return parse_html(lexer, valid_symbols, true);
                 case '~':
                     if (valid_symbols[FENCED_CODE_BLOCK_START_TILDE] || valid_symbols[FENCED_CODE_BLOCK_END_TILDE]) {
                         size_t level = 0;
@@ -368,8 +1295,6 @@ struct Scanner {
                             return true;
                         }
                         if (valid_symbols[FENCED_CODE_BLOCK_START_TILDE] && level >= 3) {
-                            if (state & STATE_WAS_SOFT_LINE_BREAK) return error(lexer);
-                            state &= ~STATE_NEED_OPEN_BLOCK;
                             lexer->result_symbol = FENCED_CODE_BLOCK_START_TILDE;
                             open_blocks.push_back(FENCED_CODE_BLOCK);
                             code_span_delimiter_length = level;
@@ -387,9 +1312,9 @@ struct Scanner {
                             level++;
                         }
                         if (level <= 6 && (lexer->lookahead == ' ' || lexer->lookahead == '\t' || lexer->lookahead == '\n' || lexer->lookahead == '\r')) {
-                            if (state & STATE_WAS_SOFT_LINE_BREAK) return error(lexer);
-                            state &= ~STATE_NEED_OPEN_BLOCK;
                             lexer->result_symbol = ATX_H1_MARKER + (level - 1);
+                            state |= STATE_ATX_HEADING;
+                            emphasis_stack_size = 0;
                             indentation = 0;
                             lexer->mark_end(lexer);
                             return true;
@@ -406,8 +1331,6 @@ struct Scanner {
                             advance(lexer);
                         }
                         if (lexer->lookahead == '\n' || lexer->lookahead == '\r') {
-                            if (state & STATE_WAS_SOFT_LINE_BREAK) return error(lexer);
-                            state &= ~STATE_NEED_OPEN_BLOCK;
                             lexer->result_symbol = SETEXT_H1_UNDERLINE;
                             lexer->mark_end(lexer);
                             return true;
@@ -428,9 +1351,6 @@ struct Scanner {
                         }
                         dont_interrupt = dont_interrupt && !(state & STATE_JUST_CLOSED) && matched == open_blocks.size();
                         if (extra_indentation >= 1 && (dont_interrupt ? valid_symbols[LIST_MARKER_PLUS_DONT_INTERRUPT] : valid_symbols[LIST_MARKER_PLUS])) {
-                            if (state & STATE_WAS_SOFT_LINE_BREAK) return error(lexer);
-                            if (!dont_interrupt) state &= ~STATE_NEED_OPEN_BLOCK;
-                            if (dont_interrupt && (state & STATE_NEED_OPEN_BLOCK)) return error(lexer);
                             lexer->result_symbol = dont_interrupt ? LIST_MARKER_PLUS_DONT_INTERRUPT : LIST_MARKER_PLUS;
                             extra_indentation--;
                             if (extra_indentation <= 3) {
@@ -438,7 +1358,7 @@ struct Scanner {
                                 indentation = 0;
                             } else {
                                 size_t temp = indentation;
-                                indentation = extra_indentation;
+                                indentation = std::min<size_t>(extra_indentation, UINT8_MAX);
                                 extra_indentation = temp;
                             }
                             open_blocks.push_back(Block(LIST_ITEM + extra_indentation));
@@ -488,9 +1408,6 @@ struct Scanner {
                                 }
                                 dont_interrupt = dont_interrupt && !(state & STATE_JUST_CLOSED) && matched == open_blocks.size();
                                 if (extra_indentation >= 1 && (dot ? (dont_interrupt ? valid_symbols[LIST_MARKER_DOT_DONT_INTERRUPT] : valid_symbols[LIST_MARKER_DOT]) : (dont_interrupt ? valid_symbols[LIST_MARKER_PARENTHESIS_DONT_INTERRUPT] : valid_symbols[LIST_MARKER_PARENTHESIS]))) {
-                                    if (state & STATE_WAS_SOFT_LINE_BREAK) return error(lexer);
-                                    if (!dont_interrupt) state &= ~STATE_NEED_OPEN_BLOCK;
-                                    if (dont_interrupt && (state & STATE_NEED_OPEN_BLOCK)) return error(lexer);
                                     lexer->result_symbol = dot ? LIST_MARKER_DOT : LIST_MARKER_PARENTHESIS;
                                     extra_indentation--;
                                     if (extra_indentation <= 3) {
@@ -498,7 +1415,7 @@ struct Scanner {
                                         indentation = 0;
                                     } else {
                                         size_t temp = indentation;
-                                        indentation = extra_indentation;
+                                        indentation = std::min<size_t>(extra_indentation, UINT8_MAX);
                                         extra_indentation = temp;
                                     }
                                     open_blocks.push_back(Block(LIST_ITEM + extra_indentation + digits));
@@ -506,6 +1423,8 @@ struct Scanner {
                                 }
                             }
                         }
+                    } else {
+                        return parse_text_run(lexer, valid_symbols);
                     }
                     break;
                 case '-':
@@ -546,23 +1465,16 @@ struct Scanner {
                         bool underline = minus_count >= 1 && !minus_after_whitespace && line_end && matched == open_blocks.size(); // setext heading can not break lazy continuation
                         bool list_marker_minus = minus_count >= 1 && extra_indentation >= 1;
                         if (valid_symbols[SETEXT_H2_UNDERLINE] && underline) {
-                            if (state & STATE_WAS_SOFT_LINE_BREAK) return error(lexer);
-                            state &= ~STATE_NEED_OPEN_BLOCK;
                             lexer->result_symbol = SETEXT_H2_UNDERLINE;
                             lexer->mark_end(lexer);
                             indentation = 0;
                             return true;
                         } else if (valid_symbols[THEMATIC_BREAK] && thematic_break) { // underline is false if list_marker_minus is true
-                            if (state & STATE_WAS_SOFT_LINE_BREAK) return error(lexer);
-                            state &= ~STATE_NEED_OPEN_BLOCK;
                             lexer->result_symbol = THEMATIC_BREAK;
                             lexer->mark_end(lexer);
                             indentation = 0;
                             return true;
                         } else if ((dont_interrupt ? valid_symbols[LIST_MARKER_MINUS_DONT_INTERRUPT] : valid_symbols[LIST_MARKER_MINUS]) && list_marker_minus) {
-                            if (state & STATE_WAS_SOFT_LINE_BREAK) return error(lexer);
-                            if (!dont_interrupt) state &= ~STATE_NEED_OPEN_BLOCK;
-                            if (dont_interrupt && (state & STATE_NEED_OPEN_BLOCK)) return error(lexer);
                             if (minus_count == 1) {
                                 lexer->mark_end(lexer);
                             }
@@ -572,7 +1484,7 @@ struct Scanner {
                                 indentation = 0;
                             } else {
                                 size_t temp = indentation;
-                                indentation = extra_indentation;
+                                indentation = std::min<size_t>(extra_indentation, UINT8_MAX);
                                 extra_indentation = temp;
                             }
                             open_blocks.push_back(Block(LIST_ITEM + extra_indentation));
@@ -581,6 +1493,8 @@ struct Scanner {
                         }
                     }
                     break;
+                default:
+                    return parse_text_run(lexer, valid_symbols);
             }
         } else { // we are in the state of trying to match all currently open blocks
             bool partial_success = false;
@@ -606,7 +1520,7 @@ struct Scanner {
                 }
             }
             if (partial_success) {
-                if (!valid_symbols[SOFT_LINE_BREAK_MARKER] && matched == open_blocks.size()) {
+                if (!(state & STATE_SOFT_LINE_BREAK) && matched == open_blocks.size()) {
                     state &= (~STATE_MATCHING);
                 }
                 if (open_blocks[matched - 1] == BLOCK_QUOTE) {
@@ -617,16 +1531,8 @@ struct Scanner {
                 return true;
             }
 
-            uint8_t split_token_count = (state & STATE_SPLIT_TOKEN_COUNT) >> 5;
-            if (valid_symbols[SPLIT_TOKEN] && split_token_count < 2) {
-                split_token_count++;
-                state &= ~STATE_SPLIT_TOKEN_COUNT;
-                state |= split_token_count << 5;
-                state |= STATE_NEED_OPEN_BLOCK;
-                lexer->result_symbol = SPLIT_TOKEN;
-                return true;
-            }
-            if (!valid_symbols[SOFT_LINE_BREAK_MARKER]) {
+            // Blocks that are not matched stay open on a lazy continuation line
+            if (!(state & STATE_SOFT_LINE_BREAK) || !valid_symbols[SOFT_LINE_BREAK_MARKER]) {
                 Block block = open_blocks[open_blocks.size() - 1];
                 lexer->result_symbol = BLOCK_CLOSE;
                 if (block == FENCED_CODE_BLOCK) {
@@ -640,8 +1546,7 @@ struct Scanner {
                 state |= STATE_JUST_CLOSED;
                 return true;
             } else {
-                state &= (~STATE_MATCHING) & (~STATE_NEED_OPEN_BLOCK);
-                state |= STATE_WAS_SOFT_LINE_BREAK;
+                state &= (~STATE_MATCHING) & (~STATE_SOFT_LINE_BREAK);
                 lexer->result_symbol = SOFT_LINE_BREAK_MARKER;
                 return true;
             }
@@ -698,47 +1603,1048 @@ struct Scanner {
                 break;
             case FENCED_CODE_BLOCK:
             case ANONYMOUS:
+            case HTML_BLOCK_1:
+            case HTML_BLOCK_2:
+            case HTML_BLOCK_3:
+            case HTML_BLOCK_4:
+            case HTML_BLOCK_5:
+            case HTML_BLOCK_6:
                 return true;
         }
         return false;
     }
 
-    bool parse_backtick(TSLexer *lexer, const bool *valid_symbols) {
-        // count the number of backticks
-        size_t level = 0;
-        while (lexer->lookahead == '`') {
-            advance(lexer);
-            level++;
-        }
-        lexer->mark_end(lexer);
-        // If this is able to close a fenced code block then that is the only valid interpretation.
-        // It can only close a fenced code block if the number of backticks is at least the number
-        // of backticks of the opening delimiter. Also it cannot be indented more than 3 spaces.
-        if (
-            valid_symbols[FENCED_CODE_BLOCK_END_BACKTICK] &&
-            indentation < 4 &&
-            level >= code_span_delimiter_length &&
-            (lexer->lookahead == '\n' || lexer->lookahead == '\r')
-        ) {
-            lexer->result_symbol = FENCED_CODE_BLOCK_END_BACKTICK;
-            return true;
+    // Decides at the beginning of the line after a line ending inside a paragraph whether the
+    // paragraph goes on, possibly as a lazy continuation line, or whether it ends. The open blocks
+    // are matched ahead of time like in `scan_token` and the rest of the line is checked for the
+    // start of a block. This way exactly one of `$._soft_line_break_marker` or the tokens ending
+    // the paragraph is emitted for the line.
+    //
+    // This consumes input, so the current token has to be ended before. Resets `matched`,
+    // `indentation` and `column` to their values at the beginning of the line.
+    bool paragraph_continues(TSLexer *lexer) {
+        for (;;) {
+            while (lexer->lookahead == ' ' || lexer->lookahead == '\t') {
+                add_indentation(advance(lexer));
+            }
+            bool partial_success = false;
+            while (matched < open_blocks.size()) {
+                if (matched == open_blocks.size() - 1 && (state & STATE_CLOSE_BLOCK)) break;
+                if (open_blocks[matched] == BLOCK_QUOTE && partial_success) break;
+                if (!match(lexer, open_blocks[matched])) break;
+                partial_success = true;
+                matched++;
+                if (open_blocks[matched - 1] == BLOCK_QUOTE) break;
+            }
+            if (!partial_success) break;
         }
-        // If this could be the start of a fenced code block, check if the info string contains any
-        // backticks.
-        if (valid_symbols[FENCED_CODE_BLOCK] && level >= 3) {
-            bool info_string_has_backtick = false;
-            while (lexer->lookahead != '\n' && lexer->lookahead != '\r' && !lexer->eof(lexer)) {
-                if (lexer->lookahead == '`') {
-                    info_string_has_backtick = true;
-                    break;
+        bool lazy = matched < open_blocks.size();
+        bool result =
+            !lexer->eof(lexer) &&
+            lexer->lookahead != '\n' &&
+            lexer->lookahead != '\r' &&
+            !line_interrupts_paragraph(lexer, lazy);
+        matched = 0;
+        indentation = 0;
+        column = 0;
+        return result;
+    }
+
+    // Checks if the rest of a line that is not blank starts a block that interrupts a paragraph.
+    // If not all open blocks were matched (`lazy`), any block except an indented code block, a
+    // setext heading underline or an html block of type 7 ends the paragraph. Mirrors the checks
+    // for the start of blocks in `scan_token`.
+    bool line_interrupts_paragraph(TSLexer *lexer, bool lazy) {
+        if (indentation >= 4) return false;
+        // Blocks that would not fit on the block stack are not opened
+        bool can_open = !open_blocks.full();
+        int32_t c = lexer->lookahead;
+        switch (c) {
+            case '>':
+                return can_open;
+            case '#': {
+                size_t level = 0;
+                while (lexer->lookahead == '#' && level <= 6) {
+                    advance(lexer);
+                    level++;
                 }
-                advance(lexer);
+                return level <= 6 && (
+                    lexer->lookahead == ' ' ||
+                    lexer->lookahead == '\t' ||
+                    lexer->lookahead == '\n' ||
+                    lexer->lookahead == '\r'
+                );
             }
-            // If it does not then choose to interpret this as the start of a fenced code block.
+            case '=':
+                if (lazy) return false;
+                while (lexer->lookahead == '=') advance(lexer);
+                while (lexer->lookahead == ' ' || lexer->lookahead == '\t') advance(lexer);
+                return lexer->lookahead == '\n' || lexer->lookahead == '\r';
+            case '`':
+            case '~': {
+                size_t level = 0;
+                while (lexer->lookahead == c) {
+                    advance(lexer);
+                    level++;
+                }
+                if (level < 3 || !can_open) return false;
+                // The info string of a backtick fence can not contain backticks
+                while (c == '`' && lexer->lookahead != '\n' && lexer->lookahead != '\r' && !lexer->eof(lexer)) {
+                    if (lexer->lookahead == '`') return false;
+                    advance(lexer);
+                }
+                return true;
+            }
+            case '*':
+            case '-':
+            case '_':
+            case '+': {
+                advance(lexer);
+                bool list_marker = lexer->lookahead == ' ' || lexer->lookahead == '\t';
+                size_t count = 1;
+                bool whitespace = false;
+                bool after_whitespace = false;
+                for (;;) {
+                    if (lexer->lookahead == c) {
+                        count++;
+                        after_whitespace = whitespace;
+                        advance(lexer);
+                    } else if (lexer->lookahead == ' ' || lexer->lookahead == '\t') {
+                        whitespace = true;
+                        advance(lexer);
+                    } else {
+                        break;
+                    }
+                }
+                bool line_end = lexer->lookahead == '\n' || lexer->lookahead == '\r';
+                if (c != '+' && count >= 3 && line_end) return true;
+                if (c == '-' && !lazy && !after_whitespace && line_end) return true;
+                if (c == '_' || !can_open) return false;
+                // An empty list item can not interrupt a paragraph
+                if (count == 1 && line_end) return lazy;
+                return list_marker;
+            }
+            case '<':
+                return can_open && scan_html_block_start_1_to_6(lexer);
+            default: {
+                if (c < '0' || c > '9' || !can_open) return false;
+                size_t digits = 0;
+                while (lexer->lookahead >= '0' && lexer->lookahead <= '9') {
+                    advance(lexer);
+                    digits++;
+                }
+                if (digits > 9 || (lexer->lookahead != '.' && lexer->lookahead != ')')) return false;
+                advance(lexer);
+                bool whitespace = false;
+                while (lexer->lookahead == ' ' || lexer->lookahead == '\t') {
+                    advance(lexer);
+                    whitespace = true;
+                }
+                bool line_end = lexer->lookahead == '\n' || lexer->lookahead == '\r';
+                if (!whitespace && !line_end) return false;
+                // Only an ordered list starting with 1 and a non empty item interrupts a paragraph
+                return lazy || (c == '1' && digits == 1 && !line_end);
+            }
+        }
+    }
+
+    // The rest of a line inside of a code block, see `$._code_line` in grammar.js. At the
+    // beginning of a line of a fenced code block this could also be the closing fence. Returns
+    // false without consuming anything if the line is empty.
+    bool parse_code_line(TSLexer *lexer, const bool *valid_symbols) {
+        bool empty = true;
+        while (lexer->lookahead == ' ' || lexer->lookahead == '\t') {
+            add_indentation(advance(lexer));
+            empty = false;
+        }
+        int32_t delimiter = lexer->lookahead;
+        size_t level = 0;
+        if (delimiter == '`' || delimiter == '~') {
+            while (lexer->lookahead == delimiter) {
+                advance(lexer);
+                level++;
+            }
+        }
+        TokenType end = delimiter == '`' ? FENCED_CODE_BLOCK_END_BACKTICK : FENCED_CODE_BLOCK_END_TILDE;
+        if (
+            level > 0 &&
+            valid_symbols[end] &&
+            indentation < 4 &&
+            level >= code_span_delimiter_length &&
+            (lexer->lookahead == '\n' || lexer->lookahead == '\r')
+        ) {
+            lexer->result_symbol = end;
+            return true;
+        }
+        if (level > 0) empty = false;
+        while (lexer->lookahead != '\n' && lexer->lookahead != '\r' && !lexer->eof(lexer)) {
+            lexer->advance(lexer, false);
+            empty = false;
+        }
+        if (empty) return false;
+        indentation = 0;
+        lexer->result_symbol = CODE_LINE;
+        return true;
+    }
+
+    // Html at a `<`. If `$._html_block_start` is valid this could start an html block, otherwise
+    // it could be inline html, see `$.html_tag` in grammar.js. A line that does not start an html
+    // block can still start with inline html, so both are recognized in a single pass. Inline html
+    // can not include whitespace in front of it, so it is only considered if `whitespace_before`
+    // is false.
+    bool parse_html(TSLexer *lexer, const bool *valid_symbols, bool whitespace_before) {
+        bool block = valid_symbols[HTML_BLOCK_START] && indentation <= 3;
+        bool inline_html = valid_symbols[HTML_TAG_END] && !whitespace_before;
+        if (!block && !inline_html) return false;
+        HtmlLookahead lookahead;
+        lookahead.block_quotes = std::count(open_blocks.begin(), open_blocks.end(), BLOCK_QUOTE);
+        lookahead.consumed = 0;
+        lookahead.single_line = !inline_html;
+        lookahead.first_line_end = HTML_TAG_END_NONE;
+        lexer->advance(lexer, false);
+        if (lexer->lookahead == '!') {
+            lexer->advance(lexer, false);
+            if (lexer->lookahead == '-') {
+                lexer->advance(lexer, false);
+                if (lexer->lookahead != '-') return false;
+                lexer->advance(lexer, false);
+                // The end condition can overlap with the start, like in `<!-->`
+                if (block) return start_html_block(lexer, HTML_BLOCK_2, '-', '-');
+                return inline_html && scan_html_comment(lexer, lookahead) && emit_html_tag(lexer, lookahead);
+            }
+            if (lexer->lookahead == '[') {
+                for (const char *c = "[CDATA["; *c != 0; c++) {
+                    if (lexer->lookahead != *c) return false;
+                    lexer->advance(lexer, false);
+                }
+                if (block) return start_html_block(lexer, HTML_BLOCK_5, 0, 0);
+                return
+                    inline_html &&
+                    scan_html_until(lexer, lookahead, HTML_TAG_END_CDATA) &&
+                    emit_html_tag(lexer, lookahead);
+            }
+            if (lexer->lookahead >= 'A' && lexer->lookahead <= 'Z') {
+                if (block) return start_html_block(lexer, HTML_BLOCK_4, 0, 0);
+                return inline_html && scan_html_declaration(lexer, lookahead) && emit_html_tag(lexer, lookahead);
+            }
+            return false;
+        }
+        if (lexer->lookahead == '?') {
+            lexer->advance(lexer, false);
+            if (block) return start_html_block(lexer, HTML_BLOCK_3, 0, '?');
+            return
+                inline_html &&
+                scan_html_until(lexer, lookahead, HTML_TAG_END_PROCESSING_INSTRUCTION) &&
+                emit_html_tag(lexer, lookahead);
+        }
+
+        bool closing = lexer->lookahead == '/';
+        if (closing) lexer->advance(lexer, false);
+        char name[HTML_BLOCK_TAG_NAME_MAX_LENGTH + 1];
+        if (!parse_html_tag_name(lexer, name)) return false;
+        int32_t c = lexer->lookahead;
+        bool name_ends =
+            c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '>' || lexer->eof(lexer);
+        bool block_1_tag_name = is_tag_name_in(HTML_BLOCK_1_TAG_NAMES, name);
+        if (block && block_1_tag_name && !closing && name_ends) {
+            return start_html_block(lexer, HTML_BLOCK_1, 0, 0);
+        }
+        if (block && is_tag_name_in(HTML_BLOCK_6_TAG_NAMES, name)) {
+            if (c == '/') {
+                lexer->advance(lexer, false);
+                if (lexer->lookahead != '>') return false;
+            } else if (!name_ends) {
+                return false;
+            }
+            return start_html_block(lexer, HTML_BLOCK_6, 0, 0);
+        }
+        if (!scan_html_tag(lexer, lookahead, closing)) return false;
+        if (!block || block_1_tag_name || lookahead.first_line_end != HTML_TAG_END_NONE) {
+            return inline_html && emit_html_tag(lexer, lookahead);
+        }
+        // A complete tag followed by nothing but whitespace starts an html block of type 7, which
+        // can not interrupt a paragraph. The line is a paragraph continuation line instead.
+        lexer->mark_end(lexer);
+        while (lexer->lookahead == ' ' || lexer->lookahead == '\t') lexer->advance(lexer, false);
+        bool line_end = lexer->lookahead == '\n' || lexer->lookahead == '\r' || lexer->eof(lexer);
+        if (line_end) {
+            return start_html_block(lexer, HTML_BLOCK_6, 0, 0);
+        }
+        if (!inline_html) return false;
+        lexer->result_symbol = HTML_TAG_END;
+        return true;
+    }
+
+    // Emits `$._html_block_start` for the first line of an html block and pushes the block on the
+    // block stack, so the following lines know which end condition to look for. If the rest of
+    // the line already contains the end condition, the block is closed after this line.
+    // `before_last` and `last` are the characters before the current one, see
+    // `scan_html_block_line`.
+    bool start_html_block(TSLexer *lexer, Block block, int32_t before_last, int32_t last) {
+        if (scan_html_block_line(lexer, block, before_last, last)) state |= STATE_CLOSE_BLOCK;
+        lexer->mark_end(lexer);
+        open_blocks.push_back(block);
+        indentation = 0;
+        lexer->result_symbol = HTML_BLOCK_START;
+        return true;
+    }
+
+    // Emits inline html that was scanned completely. If it ends on a later line, only its first
+    // line is emitted and the scanner remembers how to find the end, see
+    // `parse_html_tag_continuation`.
+    bool emit_html_tag(TSLexer *lexer, const HtmlLookahead &lookahead) {
+        if (lookahead.first_line_end == HTML_TAG_END_NONE) {
+            lexer->mark_end(lexer);
+            lexer->result_symbol = HTML_TAG_END;
+        } else {
+            state |= lookahead.first_line_end << STATE_HTML_TAG_SHIFT;
+            lexer->result_symbol = HTML_TAG_LINE;
+        }
+        return true;
+    }
+
+    // The next line of inline html that did not end on the previous line. The html was already
+    // checked to be complete when its first line was scanned, so this only needs to find its end.
+    bool parse_html_tag_continuation(TSLexer *lexer) {
+        HtmlTagEnd end = HtmlTagEnd((state & STATE_HTML_TAG) >> STATE_HTML_TAG_SHIFT);
+        state &= ~STATE_HTML_TAG;
+        indentation = 0;
+        int32_t before_last = 0;
+        int32_t last = 0;
+        while (lexer->lookahead != '\n' && lexer->lookahead != '\r' && !lexer->eof(lexer)) {
+            int32_t c = lexer->lookahead;
+            lexer->advance(lexer, false);
+            bool done = false;
+            switch (end) {
+                case HTML_TAG_END_COMMENT:
+                    done = c == '>' && before_last == '-' && last == '-';
+                    break;
+                case HTML_TAG_END_PROCESSING_INSTRUCTION:
+                    done = c == '>' && last == '?';
+                    break;
+                case HTML_TAG_END_CDATA:
+                    done = c == '>' && before_last == ']' && last == ']';
+                    break;
+                case HTML_TAG_END_DECLARATION:
+                    done = c == '>';
+                    break;
+                case HTML_TAG_END_TAG:
+                    if (c == '"') end = HTML_TAG_END_DOUBLE_QUOTED;
+                    if (c == '\'') end = HTML_TAG_END_SINGLE_QUOTED;
+                    done = c == '>';
+                    break;
+                case HTML_TAG_END_DOUBLE_QUOTED:
+                    if (c == '"') end = HTML_TAG_END_TAG;
+                    break;
+                case HTML_TAG_END_SINGLE_QUOTED:
+                    if (c == '\'') end = HTML_TAG_END_TAG;
+                    break;
+                case HTML_TAG_END_NONE:
+                    break;
+            }
+            if (done) {
+                lexer->mark_end(lexer);
+                lexer->result_symbol = HTML_TAG_END;
+                return true;
+            }
+            before_last = last;
+            last = c;
+        }
+        lexer->mark_end(lexer);
+        state |= end << STATE_HTML_TAG_SHIFT;
+        lexer->result_symbol = HTML_TAG_LINE;
+        return true;
+    }
+
+    // Advance past the current character while looking ahead in inline html. Line endings are
+    // skipped together with the block structure of the next line. At the first line ending the
+    // end of the token is marked and `end` is remembered as the way the html ends on one of the
+    // next lines. Returns false if the html can not go on.
+    bool advance_html(TSLexer *lexer, HtmlLookahead &lookahead, HtmlTagEnd end) {
+        if (lexer->eof(lexer) || lookahead.consumed >= HTML_TAG_LOOKAHEAD_LIMIT) return false;
+        int32_t c = lexer->lookahead;
+        if (c == '\n' || c == '\r') {
+            if (lookahead.single_line) return false;
+            if (lookahead.first_line_end == HTML_TAG_END_NONE) {
+                lexer->mark_end(lexer);
+                lookahead.first_line_end = end;
+            }
+            return skip_paragraph_line_ending(lexer, lookahead.block_quotes, lookahead.consumed);
+        }
+        lexer->advance(lexer, false);
+        lookahead.consumed++;
+        return true;
+    }
+
+    // The rest of an html comment after `<!--`. The text of the comment can not start with `>` or
+    // `->` and can not contain `--`, so the first `--` has to be followed by the final `>`.
+    //
+    // https://github.github.com/gfm/#html-comment
+    bool scan_html_comment(TSLexer *lexer, HtmlLookahead &lookahead) {
+        if (lexer->lookahead == '>') return false;
+        int32_t last = 0;
+        if (lexer->lookahead == '-') {
+            lexer->advance(lexer, false);
+            if (lexer->lookahead == '>') return false;
+            last = '-';
+        }
+        for (;;) {
+            int32_t c = lexer->lookahead;
+            if (c == '-' && last == '-') {
+                lexer->advance(lexer, false);
+                return lexer->lookahead == '>' && advance_html(lexer, lookahead, HTML_TAG_END_COMMENT);
+            }
+            last = c == '\n' || c == '\r' ? 0 : c;
+            if (!advance_html(lexer, lookahead, HTML_TAG_END_COMMENT)) return false;
+        }
+    }
+
+    // The rest of a processing instruction after `<?` up to `?>` or of a CDATA section after
+    // `<![CDATA[` up to `]]>`.
+    //
+    // https://github.github.com/gfm/#processing-instruction
+    bool scan_html_until(TSLexer *lexer, HtmlLookahead &lookahead, HtmlTagEnd end) {
+        int32_t before_last = 0;
+        int32_t last = 0;
+        for (;;) {
+            int32_t c = lexer->lookahead;
+            if (c == '>') {
+                bool done = end == HTML_TAG_END_CDATA
+                    ? before_last == ']' && last == ']'
+                    : last == '?';
+                if (done) return advance_html(lexer, lookahead, end);
+            }
+            bool line_ending = c == '\n' || c == '\r';
+            before_last = line_ending ? 0 : last;
+            last = line_ending ? 0 : c;
+            if (!advance_html(lexer, lookahead, end)) return false;
+        }
+    }
+
+    // The rest of a declaration after `<!`: a name of upper case letters, whitespace and anything
+    // up to the next `>`.
+    //
+    // https://github.github.com/gfm/#declaration
+    bool scan_html_declaration(TSLexer *lexer, HtmlLookahead &lookahead) {
+        while (lexer->lookahead >= 'A' && lexer->lookahead <= 'Z') {
+            if (!advance_html(lexer, lookahead, HTML_TAG_END_DECLARATION)) return false;
+        }
+        int32_t c = lexer->lookahead;
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r') return false;
+        while (lexer->lookahead != '>') {
+            if (!advance_html(lexer, lookahead, HTML_TAG_END_DECLARATION)) return false;
+        }
+        return advance_html(lexer, lookahead, HTML_TAG_END_DECLARATION);
+    }
+
+    // The rest of an open or closing tag after the tag name.
+    //
+    // https://github.github.com/gfm/#open-tag
+    bool scan_html_tag(TSLexer *lexer, HtmlLookahead &lookahead, bool closing) {
+        bool whitespace;
+        if (!skip_html_whitespace(lexer, lookahead, whitespace)) return false;
+        if (!closing) {
+            while (whitespace && is_attribute_name_character(lexer->lookahead, true)) {
+                while (is_attribute_name_character(lexer->lookahead, false)) {
+                    if (!advance_html(lexer, lookahead, HTML_TAG_END_TAG)) return false;
+                }
+                if (!skip_html_whitespace(lexer, lookahead, whitespace)) return false;
+                if (lexer->lookahead == '=') {
+                    if (!advance_html(lexer, lookahead, HTML_TAG_END_TAG)) return false;
+                    if (!skip_html_whitespace(lexer, lookahead, whitespace)) return false;
+                    if (!scan_html_attribute_value(lexer, lookahead)) return false;
+                    if (!skip_html_whitespace(lexer, lookahead, whitespace)) return false;
+                }
+            }
+            if (lexer->lookahead == '/' && !advance_html(lexer, lookahead, HTML_TAG_END_TAG)) {
+                return false;
+            }
+        }
+        return lexer->lookahead == '>' && advance_html(lexer, lookahead, HTML_TAG_END_TAG);
+    }
+
+    // An unquoted, single quoted or double quoted attribute value.
+    //
+    // https://github.github.com/gfm/#attribute-value
+    bool scan_html_attribute_value(TSLexer *lexer, HtmlLookahead &lookahead) {
+        int32_t quote = lexer->lookahead;
+        if (quote == '"' || quote == '\'') {
+            HtmlTagEnd end = quote == '"' ? HTML_TAG_END_DOUBLE_QUOTED : HTML_TAG_END_SINGLE_QUOTED;
+            do {
+                if (!advance_html(lexer, lookahead, end)) return false;
+            } while (lexer->lookahead != quote);
+            return advance_html(lexer, lookahead, HTML_TAG_END_TAG);
+        }
+        size_t length = 0;
+        for (;;) {
+            int32_t c = lexer->lookahead;
+            if (c == 0 || (c < 128 && strchr(" \t\r\n\"'=<>`", c))) break;
+            if (!advance_html(lexer, lookahead, HTML_TAG_END_TAG)) return false;
+            length++;
+        }
+        return length > 0;
+    }
+
+    // Skips whitespace inside of a tag, which may include a line ending. Sets `whitespace` if there
+    // was any. Returns false if the tag can not go on.
+    bool skip_html_whitespace(TSLexer *lexer, HtmlLookahead &lookahead, bool &whitespace) {
+        whitespace = false;
+        for (;;) {
+            int32_t c = lexer->lookahead;
+            if (c != ' ' && c != '\t' && c != '\n' && c != '\r') return true;
+            if (!advance_html(lexer, lookahead, HTML_TAG_END_TAG)) return false;
+            whitespace = true;
+        }
+    }
+
+    // Checks if a line starts an html block of type 1 to 6, which unlike type 7 can interrupt a
+    // paragraph. The lexer has to be positioned at the `<`. Mirrors the checks for blocks in
+    // `parse_html`.
+    bool scan_html_block_start_1_to_6(TSLexer *lexer) {
+        lexer->advance(lexer, false);
+        if (lexer->lookahead == '!') {
+            lexer->advance(lexer, false);
+            if (lexer->lookahead == '-') {
+                lexer->advance(lexer, false);
+                return lexer->lookahead == '-';
+            }
+            if (lexer->lookahead == '[') {
+                for (const char *c = "[CDATA["; *c != 0; c++) {
+                    if (lexer->lookahead != *c) return false;
+                    lexer->advance(lexer, false);
+                }
+                return true;
+            }
+            return lexer->lookahead >= 'A' && lexer->lookahead <= 'Z';
+        }
+        if (lexer->lookahead == '?') return true;
+        bool closing = lexer->lookahead == '/';
+        if (closing) lexer->advance(lexer, false);
+        char name[HTML_BLOCK_TAG_NAME_MAX_LENGTH + 1];
+        if (!parse_html_tag_name(lexer, name)) return false;
+        int32_t c = lexer->lookahead;
+        bool name_ends =
+            c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '>' || lexer->eof(lexer);
+        if (is_tag_name_in(HTML_BLOCK_1_TAG_NAMES, name) && !closing && name_ends) return true;
+        if (!is_tag_name_in(HTML_BLOCK_6_TAG_NAMES, name)) return false;
+        if (c != '/') return name_ends;
+        lexer->advance(lexer, false);
+        return lexer->lookahead == '>';
+    }
+
+    // Consumes a tag name and writes it in lower case to `name`, which needs room for
+    // HTML_BLOCK_TAG_NAME_MAX_LENGTH characters and the terminating zero. Longer names are not
+    // part of any tag name table and are written as the empty string. Returns false if there is no
+    // tag name.
+    bool parse_html_tag_name(TSLexer *lexer, char *name) {
+        size_t length = 0;
+        for (;;) {
+            int32_t c = lexer->lookahead;
+            if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+            bool letter = c >= 'a' && c <= 'z';
+            if (!letter && (length == 0 || !((c >= '0' && c <= '9') || c == '-'))) break;
+            if (length < HTML_BLOCK_TAG_NAME_MAX_LENGTH) name[length] = c;
+            length++;
+            lexer->advance(lexer, false);
+        }
+        name[length <= HTML_BLOCK_TAG_NAME_MAX_LENGTH ? length : 0] = 0;
+        return length > 0;
+    }
+
+    // A line inside of an html block, see `$._html_block_line` in grammar.js. If the line
+    // contains the end condition of an html block of type 1 to 5, the block is closed after this
+    // line, just like after a `$._close_block`.
+    //
+    // Returns false for empty lines and for lines with only whitespace if they can be a blank line
+    // instead. The whitespace stays consumed and counts as indentation in that case.
+    bool parse_html_block_line(TSLexer *lexer, const bool *valid_symbols) {
+        if (open_blocks.size() == 0) return false;
+        Block block = open_blocks[open_blocks.size() - 1];
+        if (block < HTML_BLOCK_1 || block > HTML_BLOCK_6) return false;
+        bool empty = true;
+        while (lexer->lookahead == ' ' || lexer->lookahead == '\t') {
+            add_indentation(advance(lexer));
+            empty = false;
+        }
+        if (lexer->lookahead == '\n' || lexer->lookahead == '\r' || lexer->eof(lexer)) {
+            if (empty || (block == HTML_BLOCK_6 && valid_symbols[BLANK_LINE_START])) return false;
+        }
+        if (scan_html_block_line(lexer, block, 0, 0)) state |= STATE_CLOSE_BLOCK;
+        indentation = 0;
+        lexer->result_symbol = HTML_BLOCK_LINE;
+        return true;
+    }
+
+    // Consumes the rest of a line of an html block. Returns true if it contains the end condition
+    // of the block. `before_last` and `last` are the two characters before the current one on the
+    // same line, as far as they can be part of an end condition.
+    bool scan_html_block_line(TSLexer *lexer, Block block, int32_t before_last, int32_t last) {
+        bool end = false;
+        while (lexer->lookahead != '\n' && lexer->lookahead != '\r' && !lexer->eof(lexer)) {
+            int32_t c = lexer->lookahead;
+            if (block == HTML_BLOCK_1 && c == '<') {
+                lexer->advance(lexer, false);
+                if (lexer->lookahead == '/') {
+                    lexer->advance(lexer, false);
+                    end = end || parse_html_block_1_end_tag(lexer);
+                }
+                continue;
+            }
+            if (c == '>') {
+                switch (block) {
+                    case HTML_BLOCK_2:
+                        end = end || (before_last == '-' && last == '-');
+                        break;
+                    case HTML_BLOCK_3:
+                        end = end || last == '?';
+                        break;
+                    case HTML_BLOCK_4:
+                        end = true;
+                        break;
+                    case HTML_BLOCK_5:
+                        end = end || (before_last == ']' && last == ']');
+                        break;
+                    default:
+                        break;
+                }
+            }
+            before_last = last;
+            last = c;
+            lexer->advance(lexer, false);
+        }
+        return end;
+    }
+
+    // Consumes the name of a closing tag after `</`. Returns true if it is one of the tags that
+    // end an html block of type 1 and followed by `>`. Stops before the first character that does
+    // not fit.
+    bool parse_html_block_1_end_tag(TSLexer *lexer) {
+        char name[HTML_BLOCK_TAG_NAME_MAX_LENGTH + 1];
+        return
+            parse_html_tag_name(lexer, name) &&
+            lexer->lookahead == '>' &&
+            is_tag_name_in(HTML_BLOCK_1_TAG_NAMES, name);
+    }
+
+    // A `[` or `![` that opens the text of a link or the description of an image, see
+    // `$._link_text` in grammar.js. It is only emitted if the closing `]` is found, otherwise the
+    // bracket is plain text.
+    bool parse_link_open(TSLexer *lexer, const bool *valid_symbols) {
+        TokenType open = lexer->lookahead == '!' ? IMAGE_OPEN : LINK_OPEN;
+        if (!valid_symbols[open]) return false;
+        if (open == IMAGE_OPEN) {
+            lexer->advance(lexer, false);
+            if (lexer->lookahead != '[') return false;
+        }
+        lexer->advance(lexer, false);
+        lexer->mark_end(lexer);
+        LinkLookahead lookahead;
+        lookahead.block_quotes = std::count(open_blocks.begin(), open_blocks.end(), BLOCK_QUOTE);
+        lookahead.consumed = 0;
+        bool empty = lexer->lookahead == ']';
+        int32_t next;
+        if (!find_link_close(lexer, lookahead, open == IMAGE_OPEN, next)) return false;
+        // `]:` could also end the label of a link reference definition, which is left to the
+        // grammar
+        if (open == LINK_OPEN && next == ':') return false;
+        // Only links with a destination or label can have an empty text. The lexer is still after
+        // the `]` in this case.
+        if (empty && link_close_kind(lexer, lookahead) == LINK_CLOSE_SHORTCUT) return false;
+        lexer->result_symbol = open;
+        return true;
+    }
+
+    // The `]` that closes the text of a link or the description of an image. The token tells the
+    // grammar which kind of link this is, see `link_close_kind`.
+    bool parse_link_close(TSLexer *lexer) {
+        lexer->advance(lexer, false);
+        lexer->mark_end(lexer);
+        LinkLookahead lookahead;
+        lookahead.block_quotes = std::count(open_blocks.begin(), open_blocks.end(), BLOCK_QUOTE);
+        lookahead.consumed = 0;
+        lexer->result_symbol = link_close_kind(lexer, lookahead);
+        return true;
+    }
+
+    // Look ahead for the `]` that closes the text of a link or the description of an image. The
+    // lexer has to be positioned after the opening bracket. If a closing bracket is found, `next`
+    // is set to the character after it.
+    //
+    // Like in the grammar the text of a link can not contain brackets, except for those of images,
+    // which are skipped together with their destination or label. The description of an `image`
+    // can contain links as well.
+    //
+    // Code spans, autolinks and html bind more tightly than brackets, but a backtick string only
+    // opens a code span if a backtick string of the same length follows in the paragraph, and a
+    // `<` only opens an autolink or html if a `>` follows. This is not known when they are passed.
+    // So the lookahead goes on as if they were text and remembers them in `pending`. Once one of
+    // them gets closed after all, everything since it was inside of it and the lookahead continues
+    // from there. A closing bracket found in the meantime is only final once the end of the
+    // paragraph shows that none of the pending spans get closed. The lexer is left after the
+    // closing bracket if no span was pending when it was found.
+    bool find_link_close(TSLexer *lexer, LinkLookahead &lookahead, bool image, int32_t &next) {
+        // Number of nested links and images that are still open
+        size_t nested = 0;
+        PendingSpan pending[LINK_PENDING_SPAN_LIMIT];
+        size_t pending_size = 0;
+        // Outcome of the lookahead if none of the pending spans get closed
+        LinkSearch result = LINK_SEARCHING;
+        // Whether the next character is escaped by a backslash
+        bool escaped = false;
+        for (;;) {
+            int32_t c = lexer->lookahead;
+            uint8_t length = 0;
+            if (c == '`') {
+                while (lexer->lookahead == '`') {
+                    if (!advance_link(lexer, lookahead)) return result == LINK_FOUND;
+                    if (length < UINT8_MAX) length++;
+                }
+            } else if (!advance_link(lexer, lookahead)) {
+                // Pending spans only stay open if the paragraph ends, not at the lookahead limit
+                return result == LINK_FOUND && lookahead.consumed < LINK_LOOKAHEAD_LIMIT;
+            }
+            // Backslashes are not escapes inside of code spans, autolinks and html, so this closes
+            // the outermost pending span that it can close. The spans opened after it are inside
+            // of it.
+            if (c == '`' || c == '>') {
+                size_t i = 0;
+                while (i < pending_size && pending[i].length != length) i++;
+                if (i < pending_size) {
+                    nested = pending[i].nested;
+                    pending_size = i;
+                    result = LINK_SEARCHING;
+                    escaped = false;
+                    continue;
+                }
+            }
+            bool tag = false;
+            if (c == '<') {
+                int32_t after = lexer->lookahead;
+                tag =
+                    (after >= 'a' && after <= 'z') || (after >= 'A' && after <= 'Z') ||
+                    after == '/' || after == '!' || after == '?';
+                // Apart from comments and attribute values, autolinks and html can not contain a
+                // `<`, so a pending one is text after all
+                for (size_t i = 0; tag && i < pending_size; i++) {
+                    if (pending[i].length != 0) continue;
+                    pending_size--;
+                    memmove(&pending[i], &pending[i + 1], (pending_size - i) * sizeof(PendingSpan));
+                    break;
+                }
+            }
+            if (result != LINK_SEARCHING) {
+                if (pending_size == 0) return result == LINK_FOUND;
+                continue;
+            }
+            if (escaped) {
+                escaped = false;
+                // Only the first backtick of a backtick string is escaped
+                if (c != '`' || --length == 0) continue;
+            }
+            if (c == '\\') {
+                escaped = is_punctuation(lexer->lookahead);
+            } else if (c == '`' || tag) {
+                if (pending_size == LINK_PENDING_SPAN_LIMIT) {
+                    result = LINK_FAILED;
+                } else {
+                    pending[pending_size++] = {length, nested};
+                }
+            } else if (c == '!' && lexer->lookahead == '[') {
+                if (!advance_link(lexer, lookahead)) return false;
+                if (lexer->lookahead != ']') {
+                    if (nested == LINK_NESTING_LIMIT) {
+                        result = LINK_FAILED;
+                    } else {
+                        nested++;
+                    }
+                } else if (pending_size > 0) {
+                    // Deciding the kind of the image would look ahead past what might close a
+                    // pending span
+                    result = LINK_FAILED;
+                } else {
+                    // An empty image description has to be followed by a destination or label,
+                    // like in `parse_link_open`
+                    if (!advance_link(lexer, lookahead)) return false;
+                    if (link_close_kind(lexer, lookahead) == LINK_CLOSE_SHORTCUT) return false;
+                }
+            } else if (c == '[') {
+                if (!image || nested == LINK_NESTING_LIMIT) {
+                    result = LINK_FAILED;
+                } else {
+                    nested++;
+                }
+            } else if (c == ']') {
+                int32_t after = lexer->lookahead;
+                if (nested == 0) {
+                    result = LINK_FOUND;
+                    next = after;
+                } else {
+                    nested--;
+                    if (after == '(' || after == '[') {
+                        if (pending_size > 0) {
+                            result = LINK_FAILED;
+                        } else if (link_close_kind(lexer, lookahead) == LINK_CLOSE_SHORTCUT) {
+                            return false;
+                        }
+                    }
+                }
+            }
+            if (result != LINK_SEARCHING && pending_size == 0) return result == LINK_FOUND;
+        }
+    }
+
+    // Decides which kind of link follows from what comes after its `]`. The lexer has to be
+    // positioned after the `]` and is left after the destination or label of the link.
+    TokenType link_close_kind(TSLexer *lexer, LinkLookahead &lookahead) {
+        if (lexer->lookahead == '(') {
+            return scan_link_destination_and_title(lexer, lookahead) ? LINK_CLOSE_INLINE : LINK_CLOSE_SHORTCUT;
+        }
+        if (lexer->lookahead == '[') {
+            if (!advance_link(lexer, lookahead)) return LINK_CLOSE_SHORTCUT;
+            if (lexer->lookahead == ']') {
+                lexer->advance(lexer, false);
+                lookahead.consumed++;
+                return LINK_CLOSE_COLLAPSED_REFERENCE;
+            }
+            return scan_link_label(lexer, lookahead) ? LINK_CLOSE_FULL_REFERENCE : LINK_CLOSE_SHORTCUT;
+        }
+        return LINK_CLOSE_SHORTCUT;
+    }
+
+    // The rest of a link label after the `[`, see `$.link_label` in grammar.js. A label can not
+    // contain brackets unless they are escaped.
+    bool scan_link_label(TSLexer *lexer, LinkLookahead &lookahead) {
+        for (;;) {
+            int32_t c = lexer->lookahead;
+            if (c == '[') return false;
+            if (!advance_link(lexer, lookahead)) return false;
+            if (c == ']') return true;
+            if (c == '\\' && is_punctuation(lexer->lookahead) && !advance_link(lexer, lookahead)) {
+                return false;
+            }
+        }
+    }
+
+    // The destination and title of an inline link in parentheses, see `$.inline_link` in
+    // grammar.js. The lexer has to be positioned at the `(`.
+    //
+    // A destination can start with the same characters as a title. These are only accepted if
+    // they are a valid title as well.
+    bool scan_link_destination_and_title(TSLexer *lexer, LinkLookahead &lookahead) {
+        bool whitespace;
+        if (!advance_link(lexer, lookahead)) return false;
+        if (!skip_link_whitespace(lexer, lookahead, whitespace)) return false;
+        int32_t c = lexer->lookahead;
+        bool title = c == '"' || c == '\'' || c == '(';
+        if (!title && c != ')') {
+            bool destination = c == '<'
+                ? scan_link_angle_destination(lexer, lookahead)
+                : scan_link_raw_destination(lexer, lookahead);
+            if (!destination) return false;
+            if (!skip_link_whitespace(lexer, lookahead, whitespace)) return false;
+            c = lexer->lookahead;
+            title = whitespace && (c == '"' || c == '\'' || c == '(');
+        }
+        if (title) {
+            if (!scan_link_title(lexer, lookahead)) return false;
+            if (!skip_link_whitespace(lexer, lookahead, whitespace)) return false;
+        }
+        return lexer->lookahead == ')' && advance_link(lexer, lookahead);
+    }
+
+    // A link destination in angle brackets, which can not contain line endings or unescaped
+    // angle brackets.
+    bool scan_link_angle_destination(TSLexer *lexer, LinkLookahead &lookahead) {
+        if (!advance_link(lexer, lookahead)) return false;
+        for (;;) {
+            int32_t c = lexer->lookahead;
+            if (c == '\n' || c == '\r' || c == '<') return false;
+            if (!advance_link(lexer, lookahead)) return false;
+            if (c == '>') return true;
+            if (c == '\\' && is_punctuation(lexer->lookahead) && !advance_link(lexer, lookahead)) {
+                return false;
+            }
+        }
+    }
+
+    // A link destination without angle brackets up to the next whitespace or unbalanced `)`. Like
+    // in `$._link_destination_parenthesis` parentheses can only contain words and backslash
+    // escapes.
+    bool scan_link_raw_destination(TSLexer *lexer, LinkLookahead &lookahead) {
+        size_t parentheses = 0;
+        for (;;) {
+            int32_t c = lexer->lookahead;
+            if (c == ' ' || c == '\t' || c == '\n' || c == '\r' || lexer->eof(lexer)) {
+                return parentheses == 0;
+            }
+            if (c == ')' && parentheses == 0) return true;
+            if (!advance_link(lexer, lookahead)) return false;
+            if (c == '\\' && is_punctuation(lexer->lookahead)) {
+                if (!advance_link(lexer, lookahead)) return false;
+            } else if (c == '(') {
+                parentheses++;
+            } else if (c == ')') {
+                parentheses--;
+            } else if (parentheses > 0 && c < 128 && is_punctuation(c)) {
+                return false;
+            }
+        }
+    }
+
+    // A link title in double quotes, single quotes or parentheses. The lexer has to be positioned
+    // at the opening character.
+    bool scan_link_title(TSLexer *lexer, LinkLookahead &lookahead) {
+        int32_t open = lexer->lookahead;
+        int32_t close = open == '(' ? ')' : open;
+        if (!advance_link(lexer, lookahead)) return false;
+        for (;;) {
+            int32_t c = lexer->lookahead;
+            if (open == '(' && c == '(') return false;
+            if (!advance_link(lexer, lookahead)) return false;
+            if (c == close) return true;
+            if (c == '\\' && is_punctuation(lexer->lookahead) && !advance_link(lexer, lookahead)) {
+                return false;
+            }
+        }
+    }
+
+    // Skips whitespace inside of the parentheses of an inline link, which may include a line
+    // ending. Sets `whitespace` if there was any. Returns false if the link can not go on.
+    bool skip_link_whitespace(TSLexer *lexer, LinkLookahead &lookahead, bool &whitespace) {
+        whitespace = false;
+        for (;;) {
+            int32_t c = lexer->lookahead;
+            if (c != ' ' && c != '\t' && c != '\n' && c != '\r') return true;
+            if (!advance_link(lexer, lookahead)) return false;
+            whitespace = true;
+        }
+    }
+
+    // Advance past the current character while looking ahead in a link. Line endings are skipped
+    // together with the block structure of the next line. Returns false if the link can not go
+    // on.
+    bool advance_link(TSLexer *lexer, LinkLookahead &lookahead) {
+        if (lexer->eof(lexer) || lookahead.consumed >= LINK_LOOKAHEAD_LIMIT) return false;
+        int32_t c = lexer->lookahead;
+        if (c == '\n' || c == '\r') {
+            return skip_paragraph_line_ending(lexer, lookahead.block_quotes, lookahead.consumed);
+        }
+        lexer->advance(lexer, false);
+        lookahead.consumed++;
+        return true;
+    }
+
+    // An entity reference like `&amp;`. Only the names of `html_entities.h` are accepted.
+    bool parse_entity_reference(TSLexer *lexer) {
+        lexer->advance(lexer, false);
+        char name[HTML_ENTITY_MAX_LENGTH];
+        uint32_t length = 0;
+        for (;;) {
+            int32_t c = lexer->lookahead;
+            if (!((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9'))) break;
+            if (length == HTML_ENTITY_MAX_LENGTH) return false;
+            name[length++] = c;
+            lexer->advance(lexer, false);
+        }
+        if (lexer->lookahead != ';' || !is_html_entity(name, length)) return false;
+        lexer->advance(lexer, false);
+        lexer->result_symbol = ENTITY_REFERENCE;
+        return true;
+    }
+
+    // Plain text up to the next character that could start an inline construct, see
+    // `$._text_run` in grammar.js. The run never starts or ends with whitespace, so hard line
+    // breaks and the `$._last_token_whitespace` before emphasis delimiters are still lexed by the
+    // grammar.
+    bool parse_text_run(TSLexer *lexer, const bool *valid_symbols) {
+        if (!valid_symbols[TEXT_RUN] || indentation > 0) return false;
+        if (!is_text_run_character(lexer->lookahead)) return false;
+        for (;;) {
+            if (lexer->lookahead == ' ' || lexer->lookahead == '\t') {
+                lexer->advance(lexer, false);
+            } else if (is_text_run_character(lexer->lookahead) && !lexer->eof(lexer)) {
+                lexer->advance(lexer, false);
+                lexer->mark_end(lexer);
+            } else {
+                break;
+            }
+        }
+        lexer->result_symbol = TEXT_RUN;
+        return true;
+    }
+
+    // Determines whether the current paragraph is longer than `limit` bytes, given that `length`
+    // bytes of it were already consumed. Uses `paragraph_continues` at every line ending, so lazy
+    // continuation lines count and the markers of open blocks do not.
+    //
+    // This consumes input, so the current token has to be ended before.
+    bool paragraph_longer_than(TSLexer *lexer, size_t length, size_t limit) {
+        while (length <= limit) {
+            if (lexer->eof(lexer)) return false;
+            int32_t c = lexer->lookahead;
+            lexer->advance(lexer, false);
+            length += utf8_length(c);
+            if (c == '\r' && lexer->lookahead == '\n') {
+                lexer->advance(lexer, false);
+                length++;
+            }
+            if ((c == '\n' || c == '\r') && !paragraph_continues(lexer)) return false;
+        }
+        return true;
+    }
+
+    // The text of a degraded paragraph up to the next code span delimiter, backslash escape or
+    // line ending. A backslash that does not escape anything is part of the text. See DEGRADED
+    // INLINE CONTENT above.
+    bool parse_degraded_text(TSLexer *lexer) {
+        bool empty = true;
+        while (!lexer->eof(lexer)) {
+            int32_t c = lexer->lookahead;
+            if (c == '`' || c == '\n' || c == '\r') break;
+            lexer->advance(lexer, false);
+            if (c == '\\' && lexer->lookahead < 128 && is_punctuation(lexer->lookahead)) break;
+            lexer->mark_end(lexer);
+            empty = false;
+        }
+        if (empty) return false;
+        lexer->result_symbol = DEGRADED_TEXT;
+        return true;
+    }
+
+    bool parse_backtick(TSLexer *lexer, const bool *valid_symbols) {
+        // count the number of backticks
+        size_t level = 0;
+        while (lexer->lookahead == '`') {
+            advance(lexer);
+            level++;
+        }
+        lexer->mark_end(lexer);
+        // If this is able to close a fenced code block then that is the only valid interpretation.
+        // It can only close a fenced code block if the number of backticks is at least the number
+        // of backticks of the opening delimiter. Also it cannot be indented more than 3 spaces.
+        if (
+            valid_symbols[FENCED_CODE_BLOCK_END_BACKTICK] &&
+            indentation < 4 &&
+            level >= code_span_delimiter_length &&
+            (lexer->lookahead == '\n' || lexer->lookahead == '\r')
+        ) {
+            lexer->result_symbol = FENCED_CODE_BLOCK_END_BACKTICK;
+            return true;
+        }
+        // If this could be the start of a fenced code block, check if the info string contains any
+        // backticks.
+        if (valid_symbols[FENCED_CODE_BLOCK_START_BACKTICK] && level >= 3) {
+            bool info_string_has_backtick = false;
+            while (lexer->lookahead != '\n' && lexer->lookahead != '\r' && !lexer->eof(lexer)) {
+                if (lexer->lookahead == '`') {
+                    info_string_has_backtick = true;
+                    break;
+                }
+                advance(lexer);
+            }
+            // If it does not then choose to interpret this as the start of a fenced code block.
             if (!info_string_has_backtick) {
                 lexer->result_symbol = FENCED_CODE_BLOCK_START_BACKTICK;
-                if (state & STATE_WAS_SOFT_LINE_BREAK) return error(lexer);
-                state &= ~STATE_NEED_OPEN_BLOCK;
                 open_blocks.push_back(FENCED_CODE_BLOCK);
                 // Remember the length of the delimiter for later, since we need it to decide
                 // whether a sequence of backticks can close the block.
@@ -752,13 +2658,18 @@ struct Scanner {
         // tokens related to block structure)
         if (indentation == 0) {
             // If the sequence is exactly as long as the opening delmiter then we interpret this as
-            // a closing delimiter. Otherwise it could be a opening delimiter.
+            // a closing delimiter. Otherwise it could be a opening delimiter, but only if it gets
+            // closed later on.
             if (level == code_span_delimiter_length && valid_symbols[CODE_SPAN_CLOSE]) {
                 lexer->result_symbol = CODE_SPAN_CLOSE;
                 return true;
             } else if (valid_symbols[CODE_SPAN_START]) {
-                code_span_delimiter_length = level;
-                lexer->result_symbol = CODE_SPAN_START;
+                if (find_code_span_close(lexer, level)) {
+                    code_span_delimiter_length = level;
+                    lexer->result_symbol = CODE_SPAN_START;
+                } else {
+                    lexer->result_symbol = UNMATCHED_CODE_SPAN_DELIMITER;
+                }
                 return true;
             }
         }
@@ -769,19 +2680,7 @@ struct Scanner {
         // If `num_emphasis_delimiters_left` is not zero then we already decided that this should be
         // part of an emphasis delimiter run, so interpret it as such.
         if (num_emphasis_delimiters_left > 0) {
-            // The `STATE_EMPHASIS_DELIMITER_IS_OPEN` state flag tells us wether it should be open
-            // or close.
-            if ((state & STATE_EMPHASIS_DELIMITER_IS_OPEN) && valid_symbols[EMPHASIS_OPEN_STAR]) {
-                advance(lexer);
-                lexer->result_symbol = EMPHASIS_OPEN_STAR;
-                num_emphasis_delimiters_left--;
-                return true;
-            } else if (valid_symbols[EMPHASIS_CLOSE_STAR]) {
-                advance(lexer);
-                lexer->result_symbol = EMPHASIS_CLOSE_STAR;
-                num_emphasis_delimiters_left--;
-                return true;
-            }
+            return parse_emphasis_delimiter_continuation(lexer, valid_symbols, '*');
         }
         advance(lexer);
         lexer->mark_end(lexer);
@@ -829,8 +2728,6 @@ struct Scanner {
         bool list_marker_star = star_count >= 1 && extra_indentation >= 1;
         if (valid_symbols[THEMATIC_BREAK] && thematic_break && indentation < 4) {
             // If a thematic break is valid then it takes precedence
-            if (state & STATE_WAS_SOFT_LINE_BREAK) return error(lexer);
-            state &= ~STATE_NEED_OPEN_BLOCK;
             lexer->result_symbol = THEMATIC_BREAK;
             lexer->mark_end(lexer);
             indentation = 0;
@@ -842,9 +2739,6 @@ struct Scanner {
             && list_marker_star
         ) {
             // List markers take precedence over emphasis markers
-            if (state & STATE_WAS_SOFT_LINE_BREAK) return error(lexer);
-            if (!dont_interrupt) state &= ~STATE_NEED_OPEN_BLOCK;
-            if (dont_interrupt && (state & STATE_NEED_OPEN_BLOCK)) return error(lexer);
             // If star_count > 1 then we already called mark_end at the right point. Otherwise the
             // token should go until this point.
             if (star_count == 1) {
@@ -862,67 +2756,36 @@ struct Scanner {
                 // Otherwise the indentation level is just the indentation of the list marker. We
                 // keep the indentation after the list marker for later blocks.
                 size_t temp = indentation;
-                indentation = extra_indentation;
+                indentation = std::min<size_t>(extra_indentation, UINT8_MAX);
                 extra_indentation = temp;
             }
             open_blocks.push_back(Block(LIST_ITEM + extra_indentation));
             lexer->result_symbol =
                 dont_interrupt ? LIST_MARKER_STAR_DONT_INTERRUPT : LIST_MARKER_STAR;
             return true;
-        } else if (valid_symbols[EMPHASIS_OPEN_STAR] || valid_symbols[EMPHASIS_CLOSE_STAR]) {
+        } else if (
+            valid_symbols[EMPHASIS_OPEN_STAR] ||
+            valid_symbols[EMPHASIS_CLOSE_STAR] ||
+            valid_symbols[UNMATCHED_EMPHASIS_DELIMITER]
+        ) {
             // Be careful to not inlcude any parsed indentation. The indentation variable is only
             // for block structure.
             if (indentation > 0) return false;
-            // The desicion made for the first star also counts for all the following stars in the
-            // delimiter run. Rembemer how many there are.
-            num_emphasis_delimiters_left = star_count_before_whitespace - 1;
             // Look ahead to the next symbol (after the last star) to find out if it is whitespace
             // punctuation or other.
-            bool next_symbol_whitespace = had_whitespace || line_end;
-            bool next_symbol_punctuation = !had_whitespace && is_punctuation(lexer->lookahead);
-            // Information about the last token is in valid_symbols. See grammar.js for these
-            // tokens for how this is done.
-            if (
-                valid_symbols[EMPHASIS_CLOSE_STAR] &&
-                !valid_symbols[LAST_TOKEN_WHITESPACE] && (
-                    !valid_symbols[LAST_TOKEN_PUNCTUATION] ||
-                    next_symbol_punctuation ||
-                    next_symbol_whitespace
-                )
-            ) {
-                // Closing delimiters take precedence
-                state &= ~STATE_EMPHASIS_DELIMITER_IS_OPEN;
-                lexer->result_symbol = EMPHASIS_CLOSE_STAR;
-                return true;
-            } else if (
-                !next_symbol_whitespace && (
-                    !next_symbol_punctuation ||
-                    valid_symbols[LAST_TOKEN_PUNCTUATION] ||
-                    valid_symbols[LAST_TOKEN_WHITESPACE]
-                )
-            ) {
-                state |= STATE_EMPHASIS_DELIMITER_IS_OPEN;
-                lexer->result_symbol = EMPHASIS_OPEN_STAR;
-                return true;
-            }
+            CharacterType after = had_whitespace ? CHARACTER_WHITESPACE : character_type(lexer->lookahead);
+            return parse_emphasis_delimiter_run(
+                lexer,
+                valid_symbols,
+                delimiter_run('*', star_count_before_whitespace, last_token_type(valid_symbols), after)
+            );
         }
         return false;
     }
 
-
     bool parse_underscore(TSLexer *lexer, const bool *valid_symbols) {
         if (num_emphasis_delimiters_left > 0) {
-            if ((state & STATE_EMPHASIS_DELIMITER_IS_OPEN) && valid_symbols[EMPHASIS_OPEN_UNDERSCORE]) {
-                advance(lexer);
-                lexer->result_symbol = EMPHASIS_OPEN_UNDERSCORE;
-                num_emphasis_delimiters_left--;
-                return true;
-            } else if (valid_symbols[EMPHASIS_CLOSE_UNDERSCORE]) {
-                advance(lexer);
-                lexer->result_symbol = EMPHASIS_CLOSE_UNDERSCORE;
-                num_emphasis_delimiters_left--;
-                return true;
-            }
+            return parse_emphasis_delimiter_continuation(lexer, valid_symbols, '_');
         }
         advance(lexer);
         lexer->mark_end(lexer);
@@ -945,50 +2808,567 @@ struct Scanner {
         }
         bool line_end = lexer->lookahead == '\n' || lexer->lookahead == '\r';
         if (underscore_count >= 3 && line_end && valid_symbols[THEMATIC_BREAK]) {
-            if (state & STATE_WAS_SOFT_LINE_BREAK) return error(lexer);
-            state &= ~STATE_NEED_OPEN_BLOCK;
             lexer->result_symbol = THEMATIC_BREAK;
             lexer->mark_end(lexer);
             indentation = 0;
             return true;
         }
-        if (valid_symbols[EMPHASIS_OPEN_UNDERSCORE] || valid_symbols[EMPHASIS_CLOSE_UNDERSCORE]) {
-            num_emphasis_delimiters_left = underscore_count_before_whitespace - 1;
-            bool next_symbol_whitespace = encountered_whitespace || line_end;
-            bool next_symbol_punctuation = !encountered_whitespace && is_punctuation(lexer->lookahead);
-            bool right_flanking = !valid_symbols[LAST_TOKEN_WHITESPACE] &&
-                (!valid_symbols[LAST_TOKEN_PUNCTUATION] || next_symbol_punctuation || next_symbol_whitespace);
-            bool left_flanking = !next_symbol_whitespace &&
-                (!next_symbol_punctuation || valid_symbols[LAST_TOKEN_PUNCTUATION] || valid_symbols[LAST_TOKEN_WHITESPACE]);
-            if (valid_symbols[EMPHASIS_CLOSE_UNDERSCORE] && right_flanking && (!left_flanking || next_symbol_punctuation)) {
+        if (
+            valid_symbols[EMPHASIS_OPEN_UNDERSCORE] ||
+            valid_symbols[EMPHASIS_CLOSE_UNDERSCORE] ||
+            valid_symbols[UNMATCHED_EMPHASIS_DELIMITER]
+        ) {
+            CharacterType after = encountered_whitespace ? CHARACTER_WHITESPACE : character_type(lexer->lookahead);
+            return parse_emphasis_delimiter_run(
+                lexer,
+                valid_symbols,
+                delimiter_run('_', underscore_count_before_whitespace, last_token_type(valid_symbols), after)
+            );
+        }
+        return false;
+    }
+
+    // The type of the character before the current token. This information is communicated by the
+    // grammar through `$._last_token_whitespace` and `$._last_token_punctuation`, see grammar.js.
+    CharacterType last_token_type(const bool *valid_symbols) {
+        if (valid_symbols[LAST_TOKEN_WHITESPACE]) return CHARACTER_WHITESPACE;
+        if (valid_symbols[LAST_TOKEN_PUNCTUATION]) return CHARACTER_PUNCTUATION;
+        return CHARACTER_OTHER;
+    }
+
+    // Start parsing a new emphasis delimiter run. The lexer has to be positioned right after the
+    // delimiter run and the end of the token has to be marked after the first delimiter.
+    bool parse_emphasis_delimiter_run(TSLexer *lexer, const bool *valid_symbols, const DelimiterRun &run) {
+        state &=
+            (~STATE_EMPHASIS_DELIMITER_MOD_3) &
+            (~STATE_EMPHASIS_DELIMITER_IS_OPEN) &
+            (~STATE_EMPHASIS_DELIMITER_CAN_OPEN) &
+            (~STATE_EMPHASIS_DELIMITER_CAN_CLOSE);
+        state |= (run.length % 3) << 2;
+        if (run.can_open) state |= STATE_EMPHASIS_DELIMITER_CAN_OPEN;
+        if (run.can_close) state |= STATE_EMPHASIS_DELIMITER_CAN_CLOSE;
+        return parse_emphasis_delimiter(lexer, valid_symbols, run.character, run.length, 0);
+    }
+
+    // Continue with the next delimiter of the current emphasis delimiter run.
+    bool parse_emphasis_delimiter_continuation(TSLexer *lexer, const bool *valid_symbols, char character) {
+        advance(lexer);
+        lexer->mark_end(lexer);
+        return parse_emphasis_delimiter(
+            lexer,
+            valid_symbols,
+            character,
+            num_emphasis_delimiters_left,
+            num_emphasis_delimiters_left - 1
+        );
+    }
+
+    // Emit the token for the next delimiter of the current delimiter run. `remaining` is the number
+    // of delimiters left in the run including this one. The lexer is positioned `skip` characters
+    // before the end of the run.
+    //
+    // A delimiter run first closes as much emphasis as possible. Then, if it can open emphasis, the
+    // remaining delimiters are split into unmatched delimiters followed by the opening delimiters
+    // that will be matched.
+    bool parse_emphasis_delimiter(
+        TSLexer *lexer,
+        const bool *valid_symbols,
+        char character,
+        uint8_t remaining,
+        uint8_t skip
+    ) {
+        TokenType open = character == '*' ? EMPHASIS_OPEN_STAR : EMPHASIS_OPEN_UNDERSCORE;
+        TokenType close = character == '*' ? EMPHASIS_CLOSE_STAR : EMPHASIS_CLOSE_UNDERSCORE;
+        uint8_t length_mod_3 = (state & STATE_EMPHASIS_DELIMITER_MOD_3) >> 2;
+        bool both_flanking = false;
+        if (state & STATE_EMPHASIS_DELIMITER_CAN_CLOSE) {
+            // A closing delimiter always matches the inner most open emphasis, so only the top of
+            // the emphasis stack has to be checked.
+            EmphasisDelimiter *opener = emphasis_stack_size > 0 ?
+                &emphasis_stack[emphasis_stack_size - 1] : NULL;
+            if (
+                valid_symbols[close] &&
+                opener && opener->character == character &&
+                rule_of_3(*opener, length_mod_3, state & STATE_EMPHASIS_DELIMITER_CAN_OPEN)
+            ) {
+                opener->count--;
+                if (opener->count == 0) emphasis_stack_size--;
+                lexer->result_symbol = close;
+                return finish_emphasis_delimiter(remaining);
+            }
+            both_flanking = state & STATE_EMPHASIS_DELIMITER_CAN_OPEN;
+            state &= ~STATE_EMPHASIS_DELIMITER_CAN_CLOSE;
+        }
+        if (state & STATE_EMPHASIS_DELIMITER_CAN_OPEN) {
+            // Decide once how many of the remaining delimiters will be matched
+            state &= ~STATE_EMPHASIS_DELIMITER_CAN_OPEN;
+            if (valid_symbols[open] && emphasis_stack_size < EMPHASIS_STACK_SIZE) {
+                for (uint8_t i = 0; i < skip; i++) lexer->advance(lexer, false);
+                uint8_t matched = count_matched_delimiters(
+                    lexer, character, remaining, length_mod_3, both_flanking,
+                    any_valid(LINK_CLOSE_TOKENS, valid_symbols)
+                );
+                if (matched > 0) {
+                    emphasis_stack[emphasis_stack_size++] =
+                        {character, length_mod_3, both_flanking, matched};
+                    state |= STATE_EMPHASIS_DELIMITER_IS_OPEN;
+                }
+            }
+        }
+        bool is_open = (state & STATE_EMPHASIS_DELIMITER_IS_OPEN) && emphasis_stack_size > 0 &&
+            remaining <= emphasis_stack[emphasis_stack_size - 1].count;
+        if (is_open && valid_symbols[open]) {
+            lexer->result_symbol = open;
+        } else if (valid_symbols[UNMATCHED_EMPHASIS_DELIMITER]) {
+            // This should not happen, but if an opening delimiter can not be emitted make sure
+            // that the emphasis stack only contains delimiters that are actually open.
+            if (is_open && --emphasis_stack[emphasis_stack_size - 1].count == 0) {
+                emphasis_stack_size--;
                 state &= ~STATE_EMPHASIS_DELIMITER_IS_OPEN;
-                lexer->result_symbol = EMPHASIS_CLOSE_UNDERSCORE;
-                return true;
-            } else if (left_flanking && (!right_flanking || valid_symbols[LAST_TOKEN_PUNCTUATION])) {
-                state |= STATE_EMPHASIS_DELIMITER_IS_OPEN;
-                lexer->result_symbol = EMPHASIS_OPEN_UNDERSCORE;
-                return true;
             }
+            lexer->result_symbol = UNMATCHED_EMPHASIS_DELIMITER;
+        } else {
+            return false;
+        }
+        return finish_emphasis_delimiter(remaining);
+    }
+
+    bool finish_emphasis_delimiter(uint8_t remaining) {
+        num_emphasis_delimiters_left = remaining - 1;
+        if (num_emphasis_delimiters_left == 0) {
+            state &=
+                (~STATE_EMPHASIS_DELIMITER_MOD_3) &
+                (~STATE_EMPHASIS_DELIMITER_IS_OPEN) &
+                (~STATE_EMPHASIS_DELIMITER_CAN_OPEN) &
+                (~STATE_EMPHASIS_DELIMITER_CAN_CLOSE);
+        }
+        return true;
+    }
+
+    // Look ahead for closing delimiter runs and return how many of the `count` last delimiters of
+    // the current delimiter run will be matched. The lexer has to be positioned right after the
+    // delimiter run.
+    //
+    // This runs the "process emphasis" procedure of the spec on the delimiter runs up to the end
+    // of the paragraph, but at most `EMPHASIS_LOOKAHEAD_LIMIT` bytes. Delimiter runs in code spans
+    // and autolinks are skipped. Emphasis can not cross the brackets of a link: if the delimiter
+    // run is part of the text of a link (`link_text`) the search stops at its `]` and delimiter
+    // runs between brackets that follow are ignored.
+    uint8_t count_matched_delimiters(
+        TSLexer *lexer,
+        char character,
+        uint8_t count,
+        uint8_t length_mod_3,
+        bool both_flanking,
+        bool link_text
+    ) {
+        uint32_t no_closer = character == '*' ?
+            STATE_EMPHASIS_NO_CLOSER_STAR : STATE_EMPHASIS_NO_CLOSER_UNDERSCORE;
+        if (state & no_closer) return 0;
+
+        const size_t capacity = 2 * EMPHASIS_STACK_SIZE;
+        EmphasisDelimiter stack[capacity];
+        size_t size = emphasis_stack_size;
+        memcpy(stack, emphasis_stack, size * sizeof(EmphasisDelimiter));
+        size_t bottom = size;
+        stack[size++] = {character, length_mod_3, both_flanking, count};
+
+        // Delimiter runs inside of a code span or autolink that has not been closed yet. They only
+        // count if it does not get closed.
+        DelimiterRun pending[EMPHASIS_STACK_SIZE];
+        size_t pending_size = 0;
+        uint8_t code_span_length = 0;
+        bool autolink = false;
+        // Number of brackets opened after the delimiter run
+        size_t brackets = 0;
+
+        // Whether a delimiter run that could close emphasis of this character was seen
+        bool closer = false;
+        bool paragraph_end = false;
+
+        size_t block_quotes = std::count(open_blocks.begin(), open_blocks.end(), BLOCK_QUOTE);
+        CharacterType before = CHARACTER_PUNCTUATION;
+        bool line_start = false;
+        bool searching = true;
+        size_t consumed = 0;
+        while (searching && consumed < EMPHASIS_LOOKAHEAD_LIMIT && !lexer->eof(lexer)) {
+            int32_t c = lexer->lookahead;
+            if (c == '\n' || c == '\r') {
+                if (state & STATE_ATX_HEADING) break;
+                if (autolink) {
+                    autolink = false;
+                    for (size_t i = 0; i < pending_size && searching; i++) {
+                        searching = process_delimiter_run(stack, size, capacity, bottom, pending[i]);
+                    }
+                    pending_size = 0;
+                    if (!searching) break;
+                }
+                ParagraphLine line = skip_line_ending(lexer, block_quotes, before, consumed);
+                if (line != PARAGRAPH_CONTINUES) {
+                    paragraph_end = line == PARAGRAPH_ENDS;
+                    break;
+                }
+                line_start = before == CHARACTER_WHITESPACE;
+                continue;
+            }
+            if (c == '*' || c == '_') {
+                size_t length = 0;
+                while (lexer->lookahead == c) {
+                    lexer->advance(lexer, false);
+                    length++;
+                }
+                consumed += length;
+                CharacterType after = character_type(lexer->lookahead);
+                bool line_end = lexer->eof(lexer) || lexer->lookahead == '\n' || lexer->lookahead == '\r';
+                // A thematic break ends the paragraph
+                if (line_start && length >= 3 && line_end) break;
+                DelimiterRun run = delimiter_run(c, length, before, after);
+                if (c == character && run.can_close) closer = true;
+                if (code_span_length > 0 || autolink) {
+                    if (pending_size < EMPHASIS_STACK_SIZE) pending[pending_size++] = run;
+                } else if (brackets == 0) {
+                    searching = process_delimiter_run(stack, size, capacity, bottom, run);
+                }
+                before = CHARACTER_PUNCTUATION;
+                line_start = false;
+                continue;
+            }
+            line_start = false;
+            if (c == '`') {
+                uint8_t length = 0;
+                while (lexer->lookahead == '`') {
+                    lexer->advance(lexer, false);
+                    if (length < UINT8_MAX) length++;
+                    consumed++;
+                }
+                if (code_span_length == 0 && !autolink) {
+                    code_span_length = length;
+                    pending_size = 0;
+                } else if (length == code_span_length) {
+                    code_span_length = 0;
+                    pending_size = 0;
+                }
+                before = CHARACTER_PUNCTUATION;
+                continue;
+            }
+            if (c == '\\') {
+                lexer->advance(lexer, false);
+                consumed++;
+                if (is_punctuation(lexer->lookahead)) {
+                    lexer->advance(lexer, false);
+                    consumed++;
+                }
+                before = CHARACTER_PUNCTUATION;
+                continue;
+            }
+            if (code_span_length == 0) {
+                if (autolink && c == '>') {
+                    autolink = false;
+                    pending_size = 0;
+                } else if (autolink && (c == ' ' || c == '\t' || c == '<')) {
+                    autolink = false;
+                    for (size_t i = 0; i < pending_size && searching; i++) {
+                        searching = process_delimiter_run(stack, size, capacity, bottom, pending[i]);
+                    }
+                    pending_size = 0;
+                } else if (c == '<') {
+                    lexer->advance(lexer, false);
+                    consumed++;
+                    if ((lexer->lookahead >= 'a' && lexer->lookahead <= 'z') || (lexer->lookahead >= 'A' && lexer->lookahead <= 'Z')) {
+                        autolink = true;
+                        pending_size = 0;
+                    }
+                    before = CHARACTER_PUNCTUATION;
+                    continue;
+                } else if (!autolink && c == '[') {
+                    brackets++;
+                } else if (!autolink && c == ']' && brackets > 0) {
+                    brackets--;
+                } else if (!autolink && c == ']' && link_text) {
+                    break;
+                }
+            }
+            lexer->advance(lexer, false);
+            consumed++;
+            before = character_type(c);
+        }
+        // Code spans and autolinks that did not get closed are just text
+        for (size_t i = 0; i < pending_size && searching; i++) {
+            searching = process_delimiter_run(stack, size, capacity, bottom, pending[i]);
+        }
+        // Only set when the whole rest of the paragraph was looked at, a lookahead that stopped at
+        // the limit, a heading's line ending or a link's `]` says nothing about later delimiter runs.
+        if (!closer && (paragraph_end || lexer->eof(lexer))) state |= no_closer;
+        return count - stack[bottom].count;
+    }
+
+    // Look ahead for a backtick string of length `level` that closes a code span. The lexer has to
+    // be positioned after the opening backtick string. Only searches up to the end of the
+    // paragraph and for lengths not tracked by the code span cache at most
+    // `CODE_SPAN_LOOKAHEAD_LIMIT` bytes. See the comment on CODE SPANS above.
+    bool find_code_span_close(TSLexer *lexer, size_t level) {
+        bool cached = state & STATE_CODE_SPAN_CACHE;
+        if (cached && level <= CODE_SPAN_CACHE_SIZE && code_span_cache[level - 1] <= 1) {
+            // This is the last backtick string of its length
+            code_span_cache[level - 1] = 0;
+            return false;
+        }
+
+        // The backtick strings passed so far
+        uint8_t runs[CODE_SPAN_CACHE_SIZE] = {0};
+        size_t block_quotes = std::count(open_blocks.begin(), open_blocks.end(), BLOCK_QUOTE);
+        CharacterType before = CHARACTER_PUNCTUATION;
+        size_t consumed = 0;
+        bool escaped = false;
+        uint8_t lines = 0;
+        ParagraphLine end = PARAGRAPH_ENDS;
+        while (!lexer->eof(lexer)) {
+            // The cache is left alone, it does not track backtick strings of this length
+            if (level > CODE_SPAN_CACHE_SIZE && consumed >= CODE_SPAN_LOOKAHEAD_LIMIT) return false;
+            int32_t c = lexer->lookahead;
+            if (c == '\n' || c == '\r') {
+                if (state & STATE_ATX_HEADING) break;
+                end = skip_line_ending(lexer, block_quotes, before, consumed);
+                if (end != PARAGRAPH_CONTINUES) break;
+                if (lines < UINT8_MAX) lines++;
+                escaped = false;
+                continue;
+            }
+            if (c == '`') {
+                size_t length = 0;
+                while (lexer->lookahead == '`') {
+                    lexer->advance(lexer, false);
+                    length++;
+                }
+                consumed += length;
+                if (length == level) {
+                    if (cached) consume_code_span_cache(level, runs);
+                    return true;
+                }
+                if (length <= CODE_SPAN_CACHE_SIZE && runs[length - 1] < CODE_SPAN_CACHE_UNKNOWN) {
+                    runs[length - 1]++;
+                }
+                // Outside of a code span a backslash escape shortens the backtick string by one,
+                // so the cache can not tell which length it will have.
+                if (escaped) {
+                    if (length <= CODE_SPAN_CACHE_SIZE) runs[length - 1] = CODE_SPAN_CACHE_UNKNOWN;
+                    if (length >= 2 && length - 1 <= CODE_SPAN_CACHE_SIZE) {
+                        runs[length - 2] = CODE_SPAN_CACHE_UNKNOWN;
+                    }
+                }
+                escaped = false;
+                continue;
+            }
+            lexer->advance(lexer, false);
+            consumed++;
+            escaped = c == '\\' && !escaped;
+        }
+        state &= ~STATE_CODE_SPAN_CACHE;
+        if (end != PARAGRAPH_MAY_END) {
+            state |= STATE_CODE_SPAN_CACHE;
+            memcpy(code_span_cache, runs, CODE_SPAN_CACHE_SIZE);
+            code_span_cache_lines = lines;
         }
         return false;
     }
+
+    // Remove a code span from the code span cache. `runs` are the backtick strings inside of the code
+    // span, which has a delimiter length of `level`.
+    void consume_code_span_cache(size_t level, const uint8_t *runs) {
+        for (size_t i = 0; i < CODE_SPAN_CACHE_SIZE; i++) {
+            uint8_t count = runs[i] + (i + 1 == level ? 2 : 0);
+            if (code_span_cache[i] == CODE_SPAN_CACHE_UNKNOWN) continue;
+            if (count == CODE_SPAN_CACHE_UNKNOWN || count > code_span_cache[i]) {
+                // The cache does not match the input, so it can not be trusted anymore
+                state &= ~STATE_CODE_SPAN_CACHE;
+                return;
+            }
+            code_span_cache[i] -= count;
+        }
+    }
+
+    // Skip a line ending while looking ahead in a paragraph, together with the block quote markers
+    // of the paragraph and the indentation of the next line. Updates `before` to the type of the
+    // last skipped character.
+    ParagraphLine skip_line_ending(
+        TSLexer *lexer,
+        size_t block_quotes,
+        CharacterType &before,
+        size_t &consumed
+    ) {
+        int32_t c = lexer->lookahead;
+        lexer->advance(lexer, false);
+        if (c == '\r' && lexer->lookahead == '\n') lexer->advance(lexer, false);
+        for (size_t i = 0; i < block_quotes; i++) {
+            for (int j = 0; j < 3 && lexer->lookahead == ' '; j++) lexer->advance(lexer, false);
+            if (lexer->lookahead != '>') break;
+            lexer->advance(lexer, false);
+            if (lexer->lookahead == ' ' || lexer->lookahead == '\t') lexer->advance(lexer, false);
+        }
+        uint8_t line_indentation = 0;
+        while (lexer->lookahead == ' ' || lexer->lookahead == '\t') {
+            if (line_indentation < 4) line_indentation++;
+            lexer->advance(lexer, false);
+        }
+        consumed += line_indentation + 1;
+        before = CHARACTER_WHITESPACE;
+        if (lexer->eof(lexer) || lexer->lookahead == '\n' || lexer->lookahead == '\r') {
+            return PARAGRAPH_ENDS;
+        }
+        if (line_indentation < 4 && may_interrupt_paragraph(lexer, before)) {
+            return PARAGRAPH_MAY_END;
+        }
+        return PARAGRAPH_CONTINUES;
+    }
+
+    // Skip a line ending while looking ahead in inline content, like `skip_line_ending`. Returns
+    // false unless the next line surely continues the paragraph. Besides the blocks checked by
+    // `may_interrupt_paragraph` a line starting with `<` could start an html block.
+    bool skip_paragraph_line_ending(TSLexer *lexer, size_t block_quotes, size_t &consumed) {
+        if (state & STATE_ATX_HEADING) return false;
+        CharacterType before;
+        return
+            skip_line_ending(lexer, block_quotes, before, consumed) == PARAGRAPH_CONTINUES &&
+            lexer->lookahead != '<';
+    }
+
+    // Checks if a line might start a block that interrupts a paragraph. This is only an
+    // approximation. It may only consume characters that can not be part of a delimiter run and
+    // updates `before` to the type of the last consumed character.
+    bool may_interrupt_paragraph(TSLexer *lexer, CharacterType &before) {
+        int32_t c = lexer->lookahead;
+        switch (c) {
+            case '>':
+                return true;
+            case '#':
+            case '=':
+            case '-':
+            case '+':
+            case '~':
+                while (lexer->lookahead == c) lexer->advance(lexer, false);
+                before = CHARACTER_PUNCTUATION;
+                return
+                    lexer->eof(lexer) ||
+                    lexer->lookahead == ' ' ||
+                    lexer->lookahead == '\t' ||
+                    lexer->lookahead == '\n' ||
+                    lexer->lookahead == '\r';
+            default:
+                if (c < '0' || c > '9') return false;
+                while (lexer->lookahead >= '0' && lexer->lookahead <= '9') lexer->advance(lexer, false);
+                before = CHARACTER_OTHER;
+                if (lexer->lookahead != '.' && lexer->lookahead != ')') return false;
+                lexer->advance(lexer, false);
+                before = CHARACTER_PUNCTUATION;
+                return
+                    lexer->eof(lexer) ||
+                    lexer->lookahead == ' ' ||
+                    lexer->lookahead == '\t' ||
+                    lexer->lookahead == '\n' ||
+                    lexer->lookahead == '\r';
+        }
+    }
+};
+
+#ifdef MARKDOWN_SCANNER_STATS
+// INSTRUMENTATION
+//
+// With `-DMARKDOWN_SCANNER_STATS` every call of the scanner is counted, see `scanner_stats.h`.
+// The counters tell which tokens make the parser call the scanner, how many parse branches get
+// killed and how much input is looked at more than once. Without the define none of this is
+// compiled.
+
+static_assert(
+    LAST_TOKEN_PUNCTUATION + 1 == TREE_SITTER_MARKDOWN_EXTERNAL_TOKEN_COUNT,
+    "the token count in scanner_stats.h must match TokenType"
+);
+
+// The names of `externals` in grammar.js, in the order of `TokenType`
+const char *const TOKEN_NAMES[] = {
+    "_line_ending", "_block_close", "_block_continuation", "_block_quote_continuation",
+    "_block_quote_start", "_indented_chunk_start", "atx_h1_marker", "atx_h2_marker",
+    "atx_h3_marker", "atx_h4_marker", "atx_h5_marker", "atx_h6_marker", "setext_h1_underline",
+    "setext_h2_underline", "_thematic_break", "_list_marker_minus", "_list_marker_plus",
+    "_list_marker_star", "_list_marker_parenthesis", "_list_marker_dot",
+    "_list_marker_minus_dont_interrupt", "_list_marker_plus_dont_interrupt",
+    "_list_marker_star_dont_interrupt", "_list_marker_parenthesis_dont_interrupt",
+    "_list_marker_dot_dont_interrupt", "_fenced_code_block_start_backtick",
+    "_fenced_code_block_start_tilde", "_blank_line_start", "_fenced_code_block_end_backtick",
+    "_fenced_code_block_end_tilde", "_code_line", "_html_block_start", "_html_block_line",
+    "_open_block", "_open_block_dont_interrupt_paragraph", "_close_block", "_no_indented_chunk",
+    "_soft_line_break_marker", "_error", "_trigger_error", "_code_span_start", "_code_span_close",
+    "_unmatched_code_span_delimiter", "_emphasis_open_star", "_emphasis_open_underscore",
+    "_emphasis_close_star", "_emphasis_close_underscore", "_unmatched_emphasis_delimiter",
+    "_text_run", "entity_reference", "_html_tag_line", "_html_tag_end", "_link_open",
+    "_image_open", "_link_close_inline", "_link_close_full_reference",
+    "_link_close_collapsed_reference", "_link_close_shortcut", "_degraded_text",
+    "_last_token_whitespace", "_last_token_punctuation",
 };
 
+static_assert(
+    sizeof(TOKEN_NAMES) / sizeof(TOKEN_NAMES[0]) == TREE_SITTER_MARKDOWN_EXTERNAL_TOKEN_COUNT,
+    "every token needs a name"
+);
+
+// The counters of `TSMarkdownScannerStats`, shared by all scanners of this grammar
+struct ScannerStats {
+    std::atomic<uint64_t> calls;
+    std::atomic<uint64_t> valid[TREE_SITTER_MARKDOWN_EXTERNAL_TOKEN_COUNT];
+    std::atomic<uint64_t> emitted[TREE_SITTER_MARKDOWN_EXTERNAL_TOKEN_COUNT];
+    std::atomic<uint64_t> branch_kills;
+    std::atomic<uint64_t> discarded_bytes;
+    std::atomic<uint64_t> deserializations;
+    std::atomic<uint64_t> deserialized_bytes;
+};
+
+ScannerStats scanner_stats;
+
+void count(std::atomic<uint64_t> &counter, uint64_t amount) {
+    counter.fetch_add(amount, std::memory_order_relaxed);
+}
+
+// `Scanner::scan` with all counters updated
+bool scan_counted(Scanner *scanner, TSLexer *lexer, const bool *valid_symbols) {
+    count(scanner_stats.calls, 1);
+    for (size_t i = 0; i < TREE_SITTER_MARKDOWN_EXTERNAL_TOKEN_COUNT; i++) {
+        if (valid_symbols[i]) count(scanner_stats.valid[i], 1);
+    }
+    CountingLexer counting(lexer);
+    bool result = scanner->scan(&counting.lexer, valid_symbols);
+    if (result) {
+        lexer->result_symbol = counting.lexer.result_symbol;
+        count(scanner_stats.emitted[lexer->result_symbol], 1);
+        if (lexer->result_symbol == ERROR) count(scanner_stats.branch_kills, 1);
+        // Without a call of `mark_end` the token ends where the scanner stopped
+        if (counting.has_mark) count(scanner_stats.discarded_bytes, counting.consumed - counting.marked);
+    } else {
+        count(scanner_stats.discarded_bytes, counting.consumed);
+    }
+    return result;
+}
+#endif
+
+}
+
 extern "C" {
-    void *tree_sitter_markdown_external_scanner_create() {
+    void *EXTERNAL_SCANNER(create)() {
         return new Scanner();
     }
 
-    bool tree_sitter_markdown_external_scanner_scan(
+    bool EXTERNAL_SCANNER(scan)(
         void *payload,
         TSLexer *lexer,
         const bool *valid_symbols
     ) {
         Scanner *scanner = static_cast<Scanner *>(payload);
+#ifdef MARKDOWN_SCANNER_STATS
+        return scan_counted(scanner, lexer, valid_symbols);
+#else
         return scanner->scan(lexer, valid_symbols);
+#endif
     }
 
-    unsigned tree_sitter_markdown_external_scanner_serialize(
+    unsigned EXTERNAL_SCANNER(serialize)(
         void *payload,
         char* buffer
     ) {
@@ -996,17 +3376,51 @@ extern "C" {
         return scanner->serialize(buffer);
     }
 
-    void tree_sitter_markdown_external_scanner_deserialize(
+    void EXTERNAL_SCANNER(deserialize)(
         void *payload,
         char* buffer,
         unsigned length
     ) {
         Scanner *scanner = static_cast<Scanner *>(payload);
+#ifdef MARKDOWN_SCANNER_STATS
+        count(scanner_stats.deserializations, 1);
+        count(scanner_stats.deserialized_bytes, length);
+#endif
         scanner->deserialize(buffer, length);
     }
 
-    void tree_sitter_markdown_external_scanner_destroy(void *payload) {
+    void EXTERNAL_SCANNER(destroy)(void *payload) {
         Scanner *scanner = static_cast<Scanner *>(payload);
         delete scanner;
     }
+
+#ifdef MARKDOWN_SCANNER_STATS
+    void EXTERNAL_SCANNER(stats)(TSMarkdownScannerStats *stats) {
+        stats->calls = scanner_stats.calls.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < TREE_SITTER_MARKDOWN_EXTERNAL_TOKEN_COUNT; i++) {
+            stats->valid[i] = scanner_stats.valid[i].load(std::memory_order_relaxed);
+            stats->emitted[i] = scanner_stats.emitted[i].load(std::memory_order_relaxed);
+        }
+        stats->branch_kills = scanner_stats.branch_kills.load(std::memory_order_relaxed);
+        stats->discarded_bytes = scanner_stats.discarded_bytes.load(std::memory_order_relaxed);
+        stats->deserializations = scanner_stats.deserializations.load(std::memory_order_relaxed);
+        stats->deserialized_bytes = scanner_stats.deserialized_bytes.load(std::memory_order_relaxed);
+    }
+
+    void EXTERNAL_SCANNER(reset_stats)() {
+        scanner_stats.calls.store(0, std::memory_order_relaxed);
+        for (size_t i = 0; i < TREE_SITTER_MARKDOWN_EXTERNAL_TOKEN_COUNT; i++) {
+            scanner_stats.valid[i].store(0, std::memory_order_relaxed);
+            scanner_stats.emitted[i].store(0, std::memory_order_relaxed);
+        }
+        scanner_stats.branch_kills.store(0, std::memory_order_relaxed);
+        scanner_stats.discarded_bytes.store(0, std::memory_order_relaxed);
+        scanner_stats.deserializations.store(0, std::memory_order_relaxed);
+        scanner_stats.deserialized_bytes.store(0, std::memory_order_relaxed);
+    }
+
+    const char *EXTERNAL_SCANNER(token_name)(unsigned token) {
+        return token < TREE_SITTER_MARKDOWN_EXTERNAL_TOKEN_COUNT ? TOKEN_NAMES[token] : NULL;
+    }
+#endif
 }
@@ -0,0 +1,58 @@
+// Instrumentation counters of the external scanner.
+//
+// Only available if the scanner is compiled with `-DMARKDOWN_SCANNER_STATS`. Each of the three
+// grammars (full, `block` and `inline`) has its own set of counters, which count the calls of all
+// parsers of that grammar in the process. The counters are updated atomically, so they can be read
+// while other threads are parsing.
+
+#ifndef TREE_SITTER_MARKDOWN_SCANNER_STATS_H_
+#define TREE_SITTER_MARKDOWN_SCANNER_STATS_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Number of external tokens, in the order of `externals` in grammar.js
+#define TREE_SITTER_MARKDOWN_EXTERNAL_TOKEN_COUNT 61
+
+typedef struct {
+    // Calls of the external scanner
+    uint64_t calls;
+    // Calls of the external scanner in which a token was valid, by token
+    uint64_t valid[TREE_SITTER_MARKDOWN_EXTERNAL_TOKEN_COUNT];
+    // Tokens the external scanner emitted, by token
+    uint64_t emitted[TREE_SITTER_MARKDOWN_EXTERNAL_TOKEN_COUNT];
+    // Parse branches killed by emitting `$._error`, see `$._trigger_error` in grammar.js
+    uint64_t branch_kills;
+    // Bytes the external scanner looked at without making them part of a token: the lookahead
+    // after the end of emitted tokens and everything consumed by calls that emitted nothing.
+    // Counted from the code points the lexer returned, so invalid UTF-8 is not exact.
+    uint64_t discarded_bytes;
+    // Calls of `deserialize` and the number of bytes they read
+    uint64_t deserializations;
+    uint64_t deserialized_bytes;
+} TSMarkdownScannerStats;
+
+// Copy the current counters of a grammar's external scanner into `stats`
+void tree_sitter_markdown_external_scanner_stats(TSMarkdownScannerStats *stats);
+void tree_sitter_markdown_block_external_scanner_stats(TSMarkdownScannerStats *stats);
+void tree_sitter_markdown_inline_external_scanner_stats(TSMarkdownScannerStats *stats);
+
+// Set all counters of a grammar's external scanner to zero
+void tree_sitter_markdown_external_scanner_reset_stats(void);
+void tree_sitter_markdown_block_external_scanner_reset_stats(void);
+void tree_sitter_markdown_inline_external_scanner_reset_stats(void);
+
+// The name of an external token in grammar.js, like `_text_run`. NULL if `token` is out of range.
+// The three grammars share their external tokens.
+const char *tree_sitter_markdown_external_scanner_token_name(unsigned token);
+const char *tree_sitter_markdown_block_external_scanner_token_name(unsigned token);
+const char *tree_sitter_markdown_inline_external_scanner_token_name(unsigned token);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // TREE_SITTER_MARKDOWN_SCANNER_STATS_H_